@@ -0,0 +1,25 @@
+# - Try to find the Zstandard library
+# Once done this will define
+#
+#  Zstd_FOUND - system has libzstd
+#  Zstd_INCLUDE_DIRS - the libzstd include directories
+#  Zstd_LIBRARIES - the libraries needed to use libzstd
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+include(LibFindMacros)
+libfind_pkg_check_modules(Zstd_PKGCONF libzstd)
+
+find_path(Zstd_INCLUDE_DIR
+    NAMES zstd.h
+    HINTS ${Zstd_PKGCONF_INCLUDE_DIRS} ${Zstd_PKGCONF_INCLUDEDIR}
+)
+
+find_library(Zstd_LIBRARY
+    NAMES zstd libzstd
+    HINTS ${Zstd_PKGCONF_LIBRARY_DIRS} ${Zstd_PKGCONF_LIBDIR}
+)
+
+set(Zstd_PROCESS_LIBS Zstd_LIBRARY)
+set(Zstd_PROCESS_INCLUDES Zstd_INCLUDE_DIR)
+libfind_process(Zstd)
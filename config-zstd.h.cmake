@@ -0,0 +1,4 @@
+/* config-zstd.h.  Generated by cmake from config-zstd.h.cmake */
+
+/* Define if you have the Zstandard library */
+#cmakedefine HAVE_ZSTD 1
@@ -61,6 +61,11 @@ public:
 
     QPainterPath outline() const override;
 
+    void preWarmBrushPyramid() const override {
+        // the autobrush generates its masks directly and never
+        // touches the tip pyramid, so there is nothing to warm
+    }
+
 public:
 
     void toXML(QDomDocument& , QDomElement&) const override;
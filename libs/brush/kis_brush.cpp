@@ -483,6 +483,20 @@ void KisBrush::clearBrushPyramid()
     d->brushPyramid.reset(new KisSharedQImagePyramid());
 }
 
+void KisBrush::preWarmBrushPyramid() const
+{
+    /**
+     * Predefined grayscale tips report MASK type too, and they do
+     * use the pyramid (through the base-class mask generation), so
+     * there is deliberately no brush-type check here; KisAutoBrush,
+     * which never touches the pyramid, overrides this with a no-op.
+     */
+    if (!d->brushPyramid) return;
+
+    // pyramid() builds the mipmaps on first call and is thread-safe
+    (void) d->brushPyramid->pyramid(this);
+}
+
 void KisBrush::mask(KisFixedPaintDeviceSP dst, const KoColor& color, KisDabShape const& shape, const KisPaintInformation& info, double subPixelX, double subPixelY, qreal softnessFactor, qreal lightnessStrength) const
 {
     PlainColoringInformation pci(color.data());
@@ -330,6 +330,17 @@ public:
 
     void clearBrushPyramid();
 
+    /**
+     * Force-build the shared mipmap pyramid of the brush tip. The
+     * pyramid is created lazily (and thread-safely) on the first
+     * dab otherwise, which makes the first stroke after a preset
+     * switch hitch; calling this from a pool thread right after the
+     * preset is selected hides that cost. Generated brushes that
+     * never touch the pyramid (KisAutoBrush) override this with a
+     * no-op.
+     */
+    virtual void preWarmBrushPyramid() const;
+
     virtual void lodLimitations(KisPaintopLodLimitations *l) const;
 
     virtual bool supportsCaching() const;
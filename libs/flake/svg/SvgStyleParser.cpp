@@ -11,6 +11,8 @@
  */
 
 #include "SvgStyleParser.h"
+
+#include <QHash>
 #include "SvgLoadingContext.h"
 #include "SvgGraphicContext.h"
 #include "SvgUtil.h"
@@ -47,6 +49,7 @@ public:
 
     SvgLoadingContext &context;
     QStringList textAttributes; ///< text related attributes
+    QHash<QString, SvgStyles> parsedCssCache;
     QStringList fontAttributes; ///< font related attributes
     QStringList styleAttributes; ///< style related attributes
 };
@@ -472,28 +475,40 @@ SvgStyles SvgStyleParser::collectStyles(const KoXmlElement &e)
     // match css style rules to element
     QStringList cssStyles = d->context.matchingCssStyles(e);
 
-    // collect all css style attributes
+    // collect all css style attributes; identical style strings are
+    // shared by thousands of elements in generated SVGs (maps being
+    // the worst case), so the split/trim/filter work is memoized per
+    // unique string for the lifetime of the parser
     Q_FOREACH (const QString &style, cssStyles) {
-        QStringList substyles = style.split(';', QString::SkipEmptyParts);
-        if (!substyles.count())
-            continue;
-        for (QStringList::Iterator it = substyles.begin(); it != substyles.end(); ++it) {
-            QStringList substyle = it->split(':');
-            if (substyle.count() != 2)
-                continue;
-            QString command = substyle[0].trimmed();
-            QString params  = substyle[1].trimmed();
-
-            // toggle the namespace selector into the xml-like one
-            command.replace("|", ":");
-
-            // only use style and font attributes
-            if (d->styleAttributes.contains(command) ||
-                d->fontAttributes.contains(command) ||
-                d->textAttributes.contains(command)) {
-
-                styleMap[command] = params;
+        if (!d->parsedCssCache.contains(style)) {
+            SvgStyles parsedStyle;
+
+            QStringList substyles = style.split(';', QString::SkipEmptyParts);
+            for (QStringList::Iterator it = substyles.begin(); it != substyles.end(); ++it) {
+                QStringList substyle = it->split(':');
+                if (substyle.count() != 2)
+                    continue;
+                QString command = substyle[0].trimmed();
+                QString params  = substyle[1].trimmed();
+
+                // toggle the namespace selector into the xml-like one
+                command.replace("|", ":");
+
+                // only use style and font attributes
+                if (d->styleAttributes.contains(command) ||
+                    d->fontAttributes.contains(command) ||
+                    d->textAttributes.contains(command)) {
+
+                    parsedStyle[command] = params;
+                }
             }
+
+            d->parsedCssCache.insert(style, parsedStyle);
+        }
+
+        const SvgStyles &parsedStyle = d->parsedCssCache[style];
+        for (auto it = parsedStyle.constBegin(); it != parsedStyle.constEnd(); ++it) {
+            styleMap[it.key()] = it.value();
         }
     }
 
@@ -0,0 +1,85 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Krita contributors
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "KisChromeTraceRecorder.h"
+
+#include <QFile>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QElapsedTimer>
+#include <QThread>
+#include <QCoreApplication>
+
+struct KisChromeTraceRecorder::Private
+{
+    QFile file;
+    QMutex mutex;
+    QElapsedTimer timer;
+};
+
+KisChromeTraceRecorder* KisChromeTraceRecorder::instance()
+{
+    static KisChromeTraceRecorder recorder;
+    return &recorder;
+}
+
+KisChromeTraceRecorder::KisChromeTraceRecorder()
+{
+    const QByteArray tracePath = qgetenv("KRITA_CHROME_TRACE");
+    if (tracePath.isEmpty()) return;
+
+    m_d = new Private();
+    m_d->file.setFileName(QString::fromLocal8Bit(tracePath));
+
+    if (!m_d->file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning("Could not open the trace file %s for writing", tracePath.constData());
+        delete m_d;
+        m_d = nullptr;
+        return;
+    }
+
+    m_d->file.write("[\n");
+    m_d->timer.start();
+    m_enabled = true;
+}
+
+KisChromeTraceRecorder::~KisChromeTraceRecorder()
+{
+    if (m_d) {
+        // the trace-event format tolerates a missing closing bracket,
+        // but write it when we get the chance to shut down cleanly
+        m_d->file.write("]\n");
+        m_d->file.close();
+        delete m_d;
+    }
+}
+
+void KisChromeTraceRecorder::writeEvent(const char *name, char phase)
+{
+    const qint64 timestamp = m_d->timer.nsecsElapsed() / 1000;
+    const quint64 threadId = quint64(quintptr(QThread::currentThreadId()));
+
+    char buffer[256];
+    const int length =
+        qsnprintf(buffer, sizeof(buffer),
+                  "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%lld,\"pid\":1,\"tid\":%llu},\n",
+                  name, phase,
+                  static_cast<long long>(timestamp),
+                  static_cast<unsigned long long>(threadId));
+
+    QMutexLocker locker(&m_d->mutex);
+    m_d->file.write(buffer, length);
+}
+
+void KisChromeTraceRecorder::beginEvent(const char *name)
+{
+    writeEvent(name, 'B');
+}
+
+void KisChromeTraceRecorder::endEvent(const char *name)
+{
+    writeEvent(name, 'E');
+}
@@ -0,0 +1,75 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Krita contributors
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#ifndef KIS_CHROME_TRACE_RECORDER_H
+#define KIS_CHROME_TRACE_RECORDER_H
+
+#include <QtGlobal>
+
+#include "kritaglobal_export.h"
+
+/**
+ * An opt-in tracing recorder emitting the Chrome trace-event JSON
+ * format (loadable in chrome://tracing and Perfetto). Enable it by
+ * setting the KRITA_CHROME_TRACE environment variable to the output
+ * file path before starting Krita; when the variable is unset the
+ * per-event cost is a single branch on a cached flag, so the probes
+ * can stay in production builds.
+ *
+ * Usage: drop a KIS_TRACE_SCOPE("name") into the function to
+ * measure; spans nest per thread, which is exactly how the trace
+ * viewers display them.
+ */
+class KRITAGLOBAL_EXPORT KisChromeTraceRecorder
+{
+public:
+    static KisChromeTraceRecorder* instance();
+
+    inline bool isEnabled() const {
+        return m_enabled;
+    }
+
+    void beginEvent(const char *name);
+    void endEvent(const char *name);
+
+    class Scope
+    {
+    public:
+        inline Scope(const char *name)
+            : m_name(instance()->isEnabled() ? name : nullptr)
+        {
+            if (m_name) {
+                instance()->beginEvent(m_name);
+            }
+        }
+
+        inline ~Scope() {
+            if (m_name) {
+                instance()->endEvent(m_name);
+            }
+        }
+
+    private:
+        Q_DISABLE_COPY(Scope)
+        const char *m_name;
+    };
+
+private:
+    KisChromeTraceRecorder();
+    ~KisChromeTraceRecorder();
+
+    void writeEvent(const char *name, char phase);
+
+private:
+    bool m_enabled {false};
+    struct Private;
+    Private *m_d {nullptr};
+};
+
+#define KIS_TRACE_SCOPE(name) \
+    KisChromeTraceRecorder::Scope __kisTraceScope(name)
+
+#endif // KIS_CHROME_TRACE_RECORDER_H
@@ -495,11 +495,37 @@ void KisScanlineFill::extendedPass(KisFillInterval *currentInterval, int srcRow,
         backwardIntervalBorder = &backwardInterval.start;
     }
 
+    int numPixelsLeft = 0;
+    quint8 *dataPtr = 0;
+    const int pixelSize = m_d->device->pixelSize();
+
     do {
         x += columnIncrement;
 
-        pixelPolicy.m_srcIt->moveTo(x, srcRow);
-        quint8 *pixelPtr = const_cast<quint8*>(pixelPolicy.m_srcIt->rawDataConst()); // TODO: avoid doing const_cast
+        quint8 *pixelPtr;
+
+        /**
+         * When walking right we can reuse the contiguous run of the
+         * current tile instead of paying a random-accessor lookup
+         * per pixel (the same trick processLine() uses). Walking
+         * left the contiguous run length is unknown, so that
+         * direction keeps the per-pixel lookup.
+         */
+        if (columnIncrement == 1) {
+            if (numPixelsLeft <= 0) {
+                pixelPolicy.m_srcIt->moveTo(x, srcRow);
+                numPixelsLeft = pixelPolicy.m_srcIt->numContiguousColumns(x) - 1;
+                dataPtr = const_cast<quint8*>(pixelPolicy.m_srcIt->rawDataConst());
+            } else {
+                numPixelsLeft--;
+                dataPtr += pixelSize;
+            }
+            pixelPtr = dataPtr;
+        } else {
+            pixelPolicy.m_srcIt->moveTo(x, srcRow);
+            pixelPtr = const_cast<quint8*>(pixelPolicy.m_srcIt->rawDataConst()); // TODO: avoid doing const_cast
+        }
+
         quint8 opacity = pixelPolicy.calculateOpacity(pixelPtr, x, srcRow);
 
         if (opacity) {
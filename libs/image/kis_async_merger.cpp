@@ -4,6 +4,7 @@
  */
 
 #include "kis_async_merger.h"
+#include "KisChromeTraceRecorder.h"
 
 
 #include <kis_debug.h>
@@ -204,6 +205,8 @@ private:
 /*********************************************************************/
 
 void KisAsyncMerger::startMerge(KisBaseRectsWalker &walker, bool notifyClones) {
+    KIS_TRACE_SCOPE("merger");
+
     KisMergeWalker::LeafStack &leafStack = walker.leafStack();
 
     const bool useTempProjections = walker.needRectVaries();
@@ -83,13 +83,17 @@ MaskApplicatorFactory<KisCurveRectangleMaskGenerator, KisBrushMaskVectorApplicat
 struct KisCircleMaskGenerator::FastRowProcessor
 {
     FastRowProcessor(KisCircleMaskGenerator *maskGenerator)
-        : d(maskGenerator->d.data()) {}
+        : d(maskGenerator->d.data()),
+          spikes(maskGenerator->spikes()),
+          spikesAngle(float(M_PI) / maskGenerator->spikes()) {}
 
     template<Vc::Implementation _impl>
     void process(float* buffer, int width, float y, float cosa, float sina,
                  float centerX, float centerY);
 
     KisCircleMaskGenerator::Private *d;
+    int spikes;
+    float spikesAngle;
 };
 
 template<> void KisCircleMaskGenerator::
@@ -129,6 +133,33 @@ FastRowProcessor::process<Vc::CurrentImplementation::current()>(float* buffer, i
         Vc::float_v xr = x_ * vCosa - vSinaY_;
         Vc::float_v yr = x_ * vSina + vCosaY_;
 
+        if (spikes > 2) {
+            /**
+             * The vectorized form of fixRotation(): instead of the
+             * scalar rotate-until-inside loop, fold the angle into
+             * the [-spikesAngle, spikesAngle] wedge in one step and
+             * rebuild the coordinates from the radius. This is what
+             * used to force star-shaped tips onto the scalar
+             * applicator.
+             */
+            yr = Vc::abs(yr);
+
+            const Vc::float_v theta = Vc::atan2(yr, xr);
+            const Vc::float_v wedgeWidth(2.0f * spikesAngle);
+            const Vc::float_v rotations =
+                Vc::ceil((theta - Vc::float_v(spikesAngle)) / wedgeWidth);
+
+            const Vc::float_v foldedTheta = theta - rotations * wedgeWidth;
+            const Vc::float_v radius = Vc::sqrt(pow2(xr) + pow2(yr));
+
+            Vc::float_v foldedSin;
+            Vc::float_v foldedCos;
+            Vc::sincos(foldedTheta, &foldedSin, &foldedCos);
+
+            xr = radius * foldedCos;
+            yr = radius * foldedSin;
+        }
+
         Vc::float_v n = pow2(xr * vXCoeff) + pow2(yr * vYCoeff);
         Vc::float_m outsideMask = n > vOne;
 
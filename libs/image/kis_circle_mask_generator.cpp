@@ -84,7 +84,12 @@ bool KisCircleMaskGenerator::shouldSupersample() const
 
 bool KisCircleMaskGenerator::shouldVectorize() const
 {
-    return !shouldSupersample() && spikes() == 2;
+    /**
+     * Star-shaped tips (spikes > 2) are folded into the base wedge
+     * inside the vectorized row processor, so only supersampled
+     * (tiny) brushes keep the scalar path.
+     */
+    return !shouldSupersample();
 }
 
 KisBrushMaskApplicatorBase* KisCircleMaskGenerator::applicator()
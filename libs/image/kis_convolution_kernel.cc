@@ -71,6 +71,68 @@ const Eigen::Matrix<qreal, Eigen::Dynamic, Eigen::Dynamic>* KisConvolutionKernel
     return &(d->data);
 }
 
+bool KisConvolutionKernel::decomposeSeparable(const KisConvolutionKernelSP kernel,
+                                              KisConvolutionKernelSP *horizontalKernel,
+                                              KisConvolutionKernelSP *verticalKernel)
+{
+    const Eigen::Matrix<qreal, Eigen::Dynamic, Eigen::Dynamic> &m = *kernel->data();
+    const int rows = m.rows();
+    const int cols = m.cols();
+
+    if (rows < 2 || cols < 2) return false;
+
+    int pivotRow = 0;
+    int pivotCol = 0;
+    qreal pivotValue = 0.0;
+
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            const qreal value = m(r, c);
+
+            // negative lobes cannot survive the inter-pass clamping
+            if (value < 0.0) return false;
+
+            if (value > pivotValue) {
+                pivotValue = value;
+                pivotRow = r;
+                pivotCol = c;
+            }
+        }
+    }
+
+    if (pivotValue <= 0.0) return false;
+
+    const Eigen::Matrix<qreal, Eigen::Dynamic, 1> columnVector = m.col(pivotCol) / pivotValue;
+    const Eigen::Matrix<qreal, 1, Eigen::Dynamic> rowVector = m.row(pivotRow);
+
+    // verify that the kernel really is the outer product of the two
+    const qreal tolerance = 1e-9 * pivotValue;
+
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            if (qAbs(m(r, c) - columnVector(r) * rowVector(c)) > tolerance) {
+                return false;
+            }
+        }
+    }
+
+    const qreal columnSum = columnVector.sum();
+    if (columnSum <= 0.0) return false;
+
+    const qreal kernelFactor = kernel->factor() ? kernel->factor() : 1.0;
+
+    /**
+     * The factors are split so that the vertical pass is normalized
+     * on its own (the intermediate stays inside the channel range)
+     * and the horizontal pass carries the rest of the normalization
+     * plus the offset.
+     */
+    *verticalKernel = fromMatrix(columnVector, 0.0, columnSum);
+    *horizontalKernel = fromMatrix(rowVector, kernel->offset(), kernelFactor / columnSum);
+
+    return true;
+}
+
 KisConvolutionKernelSP KisConvolutionKernel::fromQImage(const QImage& image)
 {
     KisConvolutionKernelSP kernel = new KisConvolutionKernel(image.width(), image.height(), 0, 0);
@@ -38,6 +38,22 @@ public:
     static KisConvolutionKernelSP fromQImage(const QImage& image);
     static KisConvolutionKernelSP fromMaskGenerator(KisMaskGenerator *, qreal angle = 0.0);
     static KisConvolutionKernelSP fromMatrix(Eigen::Matrix<qreal, Eigen::Dynamic, Eigen::Dynamic> matrix, qreal offset, qreal factor);
+
+    /**
+     * Checks whether \p kernel is numerically rank-1 (that is, the
+     * outer product of a column and a row vector) with non-negative
+     * coefficients, and if so returns the 1D kernels for a two-pass
+     * separable execution: a vertical Nx1 pass followed by a
+     * horizontal 1xM pass. The factors are split so that the
+     * intermediate pass stays inside the channel range (hence the
+     * non-negativity requirement: clamping between the passes would
+     * corrupt kernels with negative lobes) and offset is only
+     * applied by the second pass.
+     */
+    static bool decomposeSeparable(const KisConvolutionKernelSP kernel,
+                                   KisConvolutionKernelSP *horizontalKernel,
+                                   KisConvolutionKernelSP *verticalKernel);
+
 private:
     struct Private;
     Private* const d;
@@ -137,6 +137,10 @@ void KisConvolutionPainter::applyMatrix(const KisConvolutionKernelSP kernel, con
         borderOp = BORDER_IGNORE;
     }
 
+    if (tryApplySeparableMatrix(kernel, src, srcPos, dstPos, areaSize, borderOp)) {
+        return;
+    }
+
     // Determine whether we convolve border pixels, or not.
     switch (borderOp) {
     case BORDER_REPEAT: {
@@ -183,6 +187,66 @@ void KisConvolutionPainter::applyMatrix(const KisConvolutionKernelSP kernel, con
     }
 }
 
+bool KisConvolutionPainter::tryApplySeparableMatrix(const KisConvolutionKernelSP kernel,
+                                                    const KisPaintDeviceSP src,
+                                                    QPoint srcPos, QPoint dstPos,
+                                                    QSize areaSize,
+                                                    KisConvolutionBorderOp borderOp)
+{
+    /**
+     * A rank-1 kernel of size NxM can be applied as two 1D passes,
+     * turning the O(N*M) work per pixel into O(N+M); for big-radius
+     * gaussian-like kernels that is the difference between minutes
+     * and seconds. Small kernels are not worth the intermediate
+     * device, and the wraparound mode has its own iterator wrapping
+     * that the two-pass scheme does not reproduce.
+     */
+    if (kernel->width() < 5 || kernel->height() < 5) return false;
+    if (src->defaultBounds()->wrapAroundMode()) return false;
+    if (m_enginePreference == FFTW) return false;
+
+    KisConvolutionKernelSP horizontalKernel;
+    KisConvolutionKernelSP verticalKernel;
+
+    if (!KisConvolutionKernel::decomposeSeparable(kernel, &horizontalKernel, &verticalKernel)) {
+        return false;
+    }
+
+    /**
+     * The vertical pass must cover the area expanded horizontally by
+     * the horizontal kernel radius, so that the second pass finds
+     * all its neighbours in the intermediate device.
+     */
+    const int horizontalMargin = horizontalKernel->width() / 2;
+    const QRect expandedRect(srcPos.x() - horizontalMargin,
+                             srcPos.y(),
+                             areaSize.width() + 2 * horizontalMargin,
+                             areaSize.height());
+
+    KisPaintDeviceSP intermediateDevice = new KisPaintDevice(src->colorSpace());
+    intermediateDevice->setDefaultBounds(src->defaultBounds());
+
+    /**
+     * Only the second pass reports progress: driving the same
+     * updater over its full range from both passes would fill the
+     * progress bar twice per convolution.
+     */
+    KisConvolutionPainter intermediatePainter(intermediateDevice);
+    intermediatePainter.applyMatrix(verticalKernel, src,
+                                    expandedRect.topLeft(), expandedRect.topLeft(),
+                                    expandedRect.size(), borderOp);
+
+    /**
+     * The horizontal kernel is one row high, so this nested call
+     * cannot recurse into the separable path again. All the data the
+     * pass needs exists in the intermediate device, hence
+     * BORDER_IGNORE.
+     */
+    applyMatrix(horizontalKernel, intermediateDevice, srcPos, dstPos, areaSize, BORDER_IGNORE);
+
+    return true;
+}
+
 bool KisConvolutionPainter::needsTransaction(const KisConvolutionKernelSP kernel) const
 {
     return !useFFTImplementation(kernel);
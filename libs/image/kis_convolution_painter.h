@@ -78,6 +78,14 @@ public:
      */
     bool needsTransaction(const KisConvolutionKernelSP kernel) const;
 
+private:
+    bool tryApplySeparableMatrix(const KisConvolutionKernelSP kernel,
+                                 const KisPaintDeviceSP src,
+                                 QPoint srcPos, QPoint dstPos, QSize areaSize,
+                                 KisConvolutionBorderOp borderOp);
+
+public:
+
     static bool supportsFFTW();
 
 protected:
@@ -33,6 +33,50 @@ private:
 
 QMutex KisConvolutionWorkerFFTLock::fftwMutex;
 
+/**
+ * A process-wide cache of the fftw plans, keyed by the transform
+ * size. Interactive previews (e.g. dragging the unsharp-mask radius
+ * slider) re-run the convolution with the same fft size over and
+ * over, and re-planning every invocation was pure overhead. The
+ * plans are executed through the new-array interface, which is safe
+ * because all the buffers come from fftw_malloc and therefore share
+ * the same alignment.
+ *
+ * Must only be used with KisConvolutionWorkerFFTLock::fftwMutex held.
+ */
+namespace KisFFTWPlanCache
+{
+struct Plans {
+    fftw_plan forward;
+    fftw_plan backward;
+};
+
+inline Plans getPlans(int fftHeight, int fftWidth, fftw_complex *buffer)
+{
+    static QHash<QPair<int, int>, Plans> cache;
+
+    const QPair<int, int> key(fftHeight, fftWidth);
+    const auto it = cache.constFind(key);
+    if (it != cache.constEnd()) {
+        return *it;
+    }
+
+    /**
+     * The plans are never evicted: another worker thread may be
+     * executing a cached plan right now (execution happens outside
+     * the mutex), and destroying it under its feet would crash.
+     * FFTW_ESTIMATE plans are tiny, so keeping one per transform
+     * size for the process lifetime is cheap.
+     */
+    Plans plans;
+    plans.forward = fftw_plan_dft_r2c_2d(fftHeight, fftWidth, (double*)buffer, buffer, FFTW_ESTIMATE);
+    plans.backward = fftw_plan_dft_c2r_2d(fftHeight, fftWidth, buffer, (double*)buffer, FFTW_ESTIMATE);
+    cache.insert(key, plans);
+
+    return plans;
+}
+}
+
 
 template<class _IteratorFactory_>
 class KisConvolutionWorkerFFT : public KisConvolutionWorker<_IteratorFactory_>
@@ -118,11 +162,13 @@ public:
         fftw_plan fftwPlanForward, fftwPlanBackward;
 
         KisConvolutionWorkerFFTLock::fftwMutex.lock();
-        fftwPlanForward = fftw_plan_dft_r2c_2d(m_fftHeight, m_fftWidth, (double*)m_kernelFFT, m_kernelFFT, FFTW_ESTIMATE);
-        fftwPlanBackward = fftw_plan_dft_c2r_2d(m_fftHeight, m_fftWidth, m_kernelFFT, (double*)m_kernelFFT, FFTW_ESTIMATE);
+        const KisFFTWPlanCache::Plans plans =
+            KisFFTWPlanCache::getPlans(m_fftHeight, m_fftWidth, m_kernelFFT);
+        fftwPlanForward = plans.forward;
+        fftwPlanBackward = plans.backward;
         KisConvolutionWorkerFFTLock::fftwMutex.unlock();
 
-        fftw_execute(fftwPlanForward);
+        fftw_execute_dft_r2c(fftwPlanForward, (double*)m_kernelFFT, m_kernelFFT);
         addToProgress(progressPerFFT);
         if (isInterrupted()) return;
 
@@ -139,11 +185,7 @@ public:
             if (isInterrupted()) return;
         }
 
-        KisConvolutionWorkerFFTLock::fftwMutex.lock();
-        fftw_destroy_plan(fftwPlanForward);
-        fftw_destroy_plan(fftwPlanBackward);
-        KisConvolutionWorkerFFTLock::fftwMutex.unlock();
-
+        // the plans stay in the process-wide cache for the next run
 
         writeResultToDevice(QRect(dstPos.x(), dstPos.y(), areaSize.width(), areaSize.height()),
                             cacheRowStride, halfKernelWidth, halfKernelHeight,
@@ -103,6 +103,7 @@ public:
             m_pixelPtrCache[c] = new qreal[channelCount];
             m_pixelPtrCacheCopy[c] = new qreal[channelCount];
         }
+        m_interimConvoResults = new qreal[m_convolveChannelsNo];
 
         // decide caching strategy
         enum TraversingDirection { Horizontal, Vertical };
@@ -247,14 +248,31 @@ public:
         }
     }
 
-    template <bool additionalMultiplierActive>
-    inline qreal convolveOneChannelFromCache(quint8* dstPtr, quint32 channel, qreal additionalMultiplier = 0.0) {
-        qreal interimConvoResult = 0;
+    /**
+     * Accumulates all the channels in a single pass over the pixel
+     * cache: the old per-channel loops chased the same cache
+     * pointers channelCount times, while here every cached pixel is
+     * touched once and the per-channel multiply-adds run over
+     * contiguous memory, which the compiler can vectorize.
+     */
+    inline void accumulateCacheAllChannels() {
+        for (quint32 k = 0; k < m_convolveChannelsNo; ++k) {
+            m_interimConvoResults[k] = 0.0;
+        }
 
         for (quint32 pIndex = 0; pIndex < m_cacheSize; ++pIndex) {
-            qreal cacheValue = m_pixelPtrCache[pIndex][channel];
-            interimConvoResult += m_kernelData[m_cacheSize - pIndex - 1] * cacheValue;
+            const qreal *cachePixel = m_pixelPtrCache[pIndex];
+            const qreal weight = m_kernelData[m_cacheSize - pIndex - 1];
+
+            for (quint32 k = 0; k < m_convolveChannelsNo; ++k) {
+                m_interimConvoResults[k] += weight * cachePixel[k];
+            }
         }
+    }
+
+    template <bool additionalMultiplierActive>
+    inline qreal finishChannelConvolution(quint8* dstPtr, quint32 channel, qreal additionalMultiplier = 0.0) {
+        const qreal interimConvoResult = m_interimConvoResults[channel];
 
         qreal channelPixelValue;
         if (additionalMultiplierActive) {
@@ -272,8 +290,10 @@ public:
     }
 
     inline void convolveCache(quint8* dstPtr) {
+        accumulateCacheAllChannels();
+
         if (m_alphaCachePos >= 0) {
-            qreal alphaValue = convolveOneChannelFromCache<false>(dstPtr, m_alphaCachePos);
+            qreal alphaValue = finishChannelConvolution<false>(dstPtr, m_alphaCachePos);
 
             // TODO: we need a special case for applying LoG filter,
             // when the alpha i suniform and therefore should not be
@@ -285,7 +305,7 @@ public:
 
                 for (quint32 k = 0; k < m_convolveChannelsNo; ++k) {
                     if (k == (quint32)m_alphaCachePos) continue;
-                    convolveOneChannelFromCache<true>(dstPtr, k, alphaValueInv);
+                    finishChannelConvolution<true>(dstPtr, k, alphaValueInv);
                 }
             } else {
                 for (quint32 k = 0; k < m_convolveChannelsNo; ++k) {
@@ -298,7 +318,7 @@ public:
             }
         } else {
             for (quint32 k = 0; k < m_convolveChannelsNo; ++k) {
-                convolveOneChannelFromCache<false>(dstPtr, k);
+                finishChannelConvolution<false>(dstPtr, k);
             }
         }
     }
@@ -345,6 +365,7 @@ public:
         delete[] m_kernelData;
         delete[] m_pixelPtrCache;
         delete[] m_pixelPtrCacheCopy;
+        delete[] m_interimConvoResults;
 
         delete[] m_minClamp;
         delete[] m_maxClamp;
@@ -362,6 +383,7 @@ private:
 
     qreal *m_kernelData;
     qreal** m_pixelPtrCache, ** m_pixelPtrCacheCopy;
+    qreal* m_interimConvoResults;
     qreal* m_minClamp, *m_maxClamp, *m_absoluteOffset;
 
     qreal m_kernelFactor;
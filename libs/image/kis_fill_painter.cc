@@ -8,6 +8,9 @@
 
 #include "kis_fill_painter.h"
 
+#include <QMutex>
+#include <QMutexLocker>
+
 #include <stdlib.h>
 #include <string.h>
 #include <cfloat>
@@ -105,6 +108,54 @@ void KisFillPainter::fillRect(const QRect &rc, const KoPatternSP pattern, const
     fillRect(rc.x(), rc.y(), rc.width(), rc.height(), pattern, offset);
 }
 
+
+namespace {
+/**
+ * Converting the pattern's QImage into a paint device costs a full
+ * color conversion of the pattern, and both pattern fill entry
+ * points used to redo it on every single fill call. The converted
+ * base devices are cached per (pattern, color space); callers take a
+ * COW copy, so the cached device itself is never mutated. The
+ * KoPatternSP in the entry pins the pattern, which rules out pointer
+ * reuse.
+ */
+KisPaintDeviceSP fetchCachedPatternDevice(const KoPatternSP pattern, const KoColorSpace *colorSpace)
+{
+    struct Entry {
+        KoPatternSP pattern;
+        const KoColorSpace *colorSpace;
+        KisPaintDeviceSP device;
+    };
+
+    static QMutex mutex;
+    static QList<Entry> cache;
+    static const int maxEntries = 8;
+
+    QMutexLocker locker(&mutex);
+
+    for (int i = 0; i < cache.size(); i++) {
+        if (cache[i].pattern == pattern &&
+            *cache[i].colorSpace == *colorSpace) {
+
+            if (i > 0) {
+                cache.move(i, 0);
+            }
+            return cache.first().device;
+        }
+    }
+
+    KisPaintDeviceSP device = new KisPaintDevice(colorSpace, pattern->name());
+    device->convertFromQImage(pattern->pattern(), 0);
+
+    cache.prepend({pattern, colorSpace, device});
+    while (cache.size() > maxEntries) {
+        cache.removeLast();
+    }
+
+    return device;
+}
+}
+
 void KisFillPainter::fillRect(qint32 x1, qint32 y1, qint32 w, qint32 h, const KoPatternSP pattern, const QPoint &offset)
 {
     if (!pattern) return;
@@ -113,8 +164,8 @@ void KisFillPainter::fillRect(qint32 x1, qint32 y1, qint32 w, qint32 h, const Ko
     if (w < 1) return;
     if (h < 1) return;
 
-    KisPaintDeviceSP patternLayer = new KisPaintDevice(device()->compositionSourceColorSpace(), pattern->name());
-    patternLayer->convertFromQImage(pattern->pattern(), 0);
+    KisPaintDeviceSP patternLayer = new KisPaintDevice(
+        *fetchCachedPatternDevice(pattern, device()->compositionSourceColorSpace()));
 
     if (!offset.isNull()) {
         patternLayer->moveTo(offset);
@@ -131,8 +182,8 @@ void KisFillPainter::fillRectNoCompose(const QRect &rc, const KoPatternSP patter
     if (rc.width() < 1) return;
     if (rc.height() < 1) return;
 
-    KisPaintDeviceSP patternLayer = new KisPaintDevice(device()->colorSpace(), pattern->name());
-    patternLayer->convertFromQImage(pattern->pattern(), 0);
+    KisPaintDeviceSP patternLayer = new KisPaintDevice(
+        *fetchCachedPatternDevice(pattern, device()->colorSpace()));
 
     fillRectNoCompose(rc.x(), rc.y(), rc.width(), rc.height(), patternLayer, QRect(0, 0, pattern->width(), pattern->height()), transform);
 }
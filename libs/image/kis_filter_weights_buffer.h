@@ -8,6 +8,10 @@
 #define __KIS_FILTER_WEIGHTS_BUFFER_H
 
 #include "kis_fixed_point_maths.h"
+#include <QSharedPointer>
+#include <QMutex>
+#include <QPair>
+#include <QList>
 #include "kis_filter_strategy.h"
 #include "kis_debug.h"
 
@@ -278,4 +282,50 @@ private:
     KisFixedPoint m_weightsPositionScale;
 };
 
+typedef QSharedPointer<KisFilterWeightsBuffer> KisFilterWeightsBufferSP;
+
+/**
+ * A small process-wide cache of weight buffers. Building the buffer
+ * evaluates the filter function (sinc, cubic...) for every phase of
+ * every span position, which used to run again for every transform
+ * pass; repeated transforms at the same scale (both passes of one
+ * transform, previews, batch scaling) now share one table. The cache
+ * keeps only a handful of recently used scales, since interactive
+ * scaling produces an unbounded stream of unique scale values; the
+ * shared pointers keep evicted buffers alive for their users.
+ */
+class KisCachedFilterWeightsBuffer
+{
+public:
+    static KisFilterWeightsBufferSP fetch(KisFilterStrategy *filterStrategy, qreal realScale) {
+        static QMutex mutex;
+        static QList<QPair<QPair<QString, qreal>, KisFilterWeightsBufferSP>> cache;
+        static const int maxCacheSize = 8;
+
+        const QPair<QString, qreal> key(filterStrategy->id(), realScale);
+
+        QMutexLocker locker(&mutex);
+
+        for (int i = 0; i < cache.size(); i++) {
+            if (cache[i].first == key) {
+                // keep the hot entries at the front
+                if (i > 0) {
+                    cache.move(i, 0);
+                }
+                return cache.first().second;
+            }
+        }
+
+        KisFilterWeightsBufferSP buffer(
+            new KisFilterWeightsBuffer(filterStrategy, realScale));
+
+        cache.prepend(qMakePair(key, buffer));
+        while (cache.size() > maxCacheSize) {
+            cache.removeLast();
+        }
+
+        return buffer;
+    }
+};
+
 #endif /* __KIS_FILTER_WEIGHTS_BUFFER_H */
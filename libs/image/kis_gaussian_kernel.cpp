@@ -8,6 +8,9 @@
 
 #include "kis_global.h"
 #include "kis_convolution_kernel.h"
+#include "kis_math_toolbox.h"
+#include "kis_iterator_ng.h"
+#include <cmath>
 #include <kis_convolution_painter.h>
 #include <kis_transaction.h>
 #include <QRect>
@@ -99,6 +102,187 @@ KisGaussianKernel::createUniform2DKernel(qreal xRadius, qreal yRadius)
 }
 
 
+
+namespace {
+
+/**
+ * Young & van Vliet (1995) recursive gaussian coefficients. Accurate
+ * for sigma of about 0.5 and above, and the cost per pixel does not
+ * depend on sigma at all.
+ */
+struct IIRGaussianCoefficients
+{
+    explicit IIRGaussianCoefficients(qreal sigma)
+    {
+        const qreal q = sigma >= 2.5 ?
+            0.98711 * sigma - 0.96330 :
+            3.97156 - 4.14554 * std::sqrt(1.0 - 0.26891 * sigma);
+
+        b0 = 1.57825 + 2.44413 * q + 1.4281 * q * q + 0.422205 * q * q * q;
+        b1 = 2.44413 * q + 2.85619 * q * q + 1.26661 * q * q * q;
+        b2 = -(1.4281 * q * q + 1.26661 * q * q * q);
+        b3 = 0.422205 * q * q * q;
+        B = 1.0 - (b1 + b2 + b3) / b0;
+    }
+
+    void filterLine(qreal *data, int length) const
+    {
+        if (length < 4) return;
+
+        // warm up with replicated edge values on both ends
+        qreal w1 = data[0];
+        qreal w2 = data[0];
+        qreal w3 = data[0];
+
+        for (int i = 0; i < length; i++) {
+            const qreal w = B * data[i] + (b1 * w1 + b2 * w2 + b3 * w3) / b0;
+            w3 = w2;
+            w2 = w1;
+            w1 = w;
+            data[i] = w;
+        }
+
+        w1 = data[length - 1];
+        w2 = data[length - 1];
+        w3 = data[length - 1];
+
+        for (int i = length - 1; i >= 0; i--) {
+            const qreal w = B * data[i] + (b1 * w1 + b2 * w2 + b3 * w3) / b0;
+            w3 = w2;
+            w2 = w1;
+            w1 = w;
+            data[i] = w;
+        }
+    }
+
+    qreal b0, b1, b2, b3, B;
+};
+
+void iirFilterPassImpl(KisPaintDeviceSP device,
+                       const QRect &rect,
+                       qreal sigma,
+                       bool verticalPass,
+                       KoUpdater *progressUpdater,
+                       int progressOffset)
+{
+    const KoColorSpace *cs = device->colorSpace();
+    const QList<KoChannelInfo*> channels = cs->channels();
+    const int channelCount = channels.count();
+
+    KisMathToolbox mathToolbox;
+    QVector<PtrToDouble> toDoubleFuncPtr(channelCount);
+    QVector<PtrFromDouble> fromDoubleFuncPtr(channelCount);
+
+    if (!mathToolbox.getToDoubleChannelPtr(channels, toDoubleFuncPtr) ||
+        !mathToolbox.getFromDoubleChannelPtr(channels, fromDoubleFuncPtr)) {
+
+        return;
+    }
+
+    int alphaIndex = -1;
+    for (int i = 0; i < channelCount; i++) {
+        if (channels[i]->channelType() == KoChannelInfo::ALPHA) {
+            alphaIndex = i;
+        }
+    }
+
+    const IIRGaussianCoefficients coefficients(sigma);
+
+    const int lineLength = verticalPass ? rect.height() : rect.width();
+    const int numLines = verticalPass ? rect.width() : rect.height();
+
+    QVector<QVector<qreal>> lineBuffers(channelCount);
+    for (int k = 0; k < channelCount; k++) {
+        lineBuffers[k].resize(lineLength);
+    }
+
+    for (int line = 0; line < numLines; line++) {
+        KisHLineIteratorSP hit;
+        KisVLineIteratorSP vit;
+
+        if (verticalPass) {
+            vit = device->createVLineIteratorNG(rect.x() + line, rect.y(), lineLength);
+        } else {
+            hit = device->createHLineIteratorNG(rect.x(), rect.y() + line, lineLength);
+        }
+
+        // fetch the line into the channel buffers, premultiplied by
+        // alpha so that transparent pixels do not bleed their colors
+        for (int i = 0; i < lineLength; i++) {
+            const quint8 *pixel = verticalPass ? vit->rawDataConst() : hit->rawDataConst();
+
+            qreal alpha = 1.0;
+            if (alphaIndex >= 0) {
+                alpha = toDoubleFuncPtr[alphaIndex](pixel, channels[alphaIndex]->pos());
+                lineBuffers[alphaIndex][i] = alpha;
+            }
+
+            for (int k = 0; k < channelCount; k++) {
+                if (k == alphaIndex) continue;
+                lineBuffers[k][i] = toDoubleFuncPtr[k](pixel, channels[k]->pos()) * alpha;
+            }
+
+            if (verticalPass) vit->nextPixel(); else hit->nextPixel();
+        }
+
+        for (int k = 0; k < channelCount; k++) {
+            coefficients.filterLine(lineBuffers[k].data(), lineLength);
+        }
+
+        if (verticalPass) {
+            vit = device->createVLineIteratorNG(rect.x() + line, rect.y(), lineLength);
+        } else {
+            hit = device->createHLineIteratorNG(rect.x(), rect.y() + line, lineLength);
+        }
+
+        for (int i = 0; i < lineLength; i++) {
+            quint8 *pixel = verticalPass ? vit->rawData() : hit->rawData();
+
+            qreal alpha = 1.0;
+            if (alphaIndex >= 0) {
+                alpha = lineBuffers[alphaIndex][i];
+                fromDoubleFuncPtr[alphaIndex](pixel, channels[alphaIndex]->pos(), alpha);
+            }
+
+            const qreal alphaRec = alpha > 0.0 ? 1.0 / alpha : 0.0;
+
+            for (int k = 0; k < channelCount; k++) {
+                if (k == alphaIndex) continue;
+                fromDoubleFuncPtr[k](pixel, channels[k]->pos(), lineBuffers[k][i] * alphaRec);
+            }
+
+            if (verticalPass) vit->nextPixel(); else hit->nextPixel();
+        }
+
+        if (progressUpdater && (line & 0x3f) == 0) {
+            progressUpdater->setProgress(progressOffset + 50 * line / numLines);
+        }
+    }
+}
+
+}
+
+void KisGaussianKernel::applyGaussianIIR(KisPaintDeviceSP device,
+                                         const QRect &rect,
+                                         qreal xRadius, qreal yRadius,
+                                         KoUpdater *progressUpdater)
+{
+    const qreal xSigma = sigmaFromRadius(xRadius);
+    const qreal ySigma = sigmaFromRadius(yRadius);
+
+    if (xRadius > 0.0 && rect.width() >= 4) {
+        iirFilterPassImpl(device, rect, xSigma, false, progressUpdater, 0);
+    }
+
+    if (yRadius > 0.0 && rect.height() >= 4) {
+        iirFilterPassImpl(device, rect, ySigma, true, progressUpdater, 50);
+    }
+
+    if (progressUpdater) {
+        progressUpdater->setProgress(100);
+    }
+}
+
 void KisGaussianKernel::applyGaussian(KisPaintDeviceSP device,
                                       const QRect& rect,
                                       qreal xRadius, qreal yRadius,
@@ -109,6 +293,28 @@ void KisGaussianKernel::applyGaussian(KisPaintDeviceSP device,
 {
     QPoint srcTopLeft = rect.topLeft();
 
+    /**
+     * Above this radius the recursive gaussian wins over both the
+     * kernel and the FFT paths while using no extra padding memory.
+     * It needs whole-scanline context, so it is only safe when the
+     * rect covers the entire working area (patch-based filter
+     * application never satisfies this and keeps the kernel path).
+     */
+    static const qreal iirRadiusThreshold = 50.0;
+
+    if (xRadius > iirRadiusThreshold && yRadius > iirRadiusThreshold &&
+        rect == device->defaultBounds()->bounds() &&
+        (channelFlags.isEmpty() ||
+         channelFlags.count(true) == channelFlags.size())) {
+
+        QScopedPointer<KisTransaction> transaction;
+        if (createTransaction) {
+            transaction.reset(new KisTransaction(device));
+        }
+
+        applyGaussianIIR(device, rect, xRadius, yRadius, progressUpdater);
+        return;
+    }
 
     if (KisConvolutionPainter::supportsFFTW()) {
         KisConvolutionPainter painter(device, KisConvolutionPainter::FFTW);
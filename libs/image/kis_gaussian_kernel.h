@@ -36,6 +36,20 @@ public:
     static qreal sigmaFromRadius(qreal radius);
     static int kernelSizeFromRadius(qreal radius);
 
+    /**
+     * A recursive (IIR) gaussian approximation after Young and van
+     * Vliet: the per-pixel cost is independent of the radius, so
+     * 300px blurs on mattes cost the same as 5px ones. The filter
+     * needs whole-scanline context, therefore it can only be used
+     * when \p rect covers the whole working area (it reads nothing
+     * outside the rect and replicates the edge pixels); callers that
+     * process patch-by-patch must keep the kernel-based path.
+     */
+    static void applyGaussianIIR(KisPaintDeviceSP device,
+                                 const QRect &rect,
+                                 qreal xRadius, qreal yRadius,
+                                 KoUpdater *progressUpdater);
+
     static void applyGaussian(KisPaintDeviceSP device,
                               const QRect& rect,
                               qreal xRadius, qreal yRadius,
@@ -1281,8 +1281,27 @@ bool KisGradientPainter::paintGradient(const QPointF& gradientVectorStart,
                           reverseGradient,
                           &cachedGradient);
 
-        while (it.nextPixel()) {
-            memcpy(it.rawData(), paintPolicy.colorAt(it.x(), it.y()), pixelSize);
+        /**
+         * The generic memcpy with a runtime size costs more than the
+         * store itself on the common 4/8-byte pixels, so specialize
+         * the copy loop per pixel size.
+         */
+        if (pixelSize == 4) {
+            while (it.nextPixel()) {
+                memcpy(it.rawData(), paintPolicy.colorAt(it.x(), it.y()), 4);
+            }
+        } else if (pixelSize == 8) {
+            while (it.nextPixel()) {
+                memcpy(it.rawData(), paintPolicy.colorAt(it.x(), it.y()), 8);
+            }
+        } else if (pixelSize == 16) {
+            while (it.nextPixel()) {
+                memcpy(it.rawData(), paintPolicy.colorAt(it.x(), it.y()), 16);
+            }
+        } else {
+            while (it.nextPixel()) {
+                memcpy(it.rawData(), paintPolicy.colorAt(it.x(), it.y()), pixelSize);
+            }
         }
 
         bitBlt(processRect.topLeft(), dev, processRect);
@@ -1485,6 +1485,11 @@ KisPaintDeviceSP KisImage::projection() const
     return projection;
 }
 
+KisPaintDeviceSP KisImage::createProjectionSnapshot() const
+{
+    return new KisPaintDevice(*projection());
+}
+
 qint32 KisImage::nlayers() const
 {
     QStringList list;
@@ -2417,6 +2422,13 @@ void KisImage::explicitRegenerateLevelOfDetail()
     }
 }
 
+void KisImage::tryWarmUpLodNOnIdle()
+{
+    if (!m_d->blockLevelOfDetail) {
+        m_d->scheduler.tryWarmUpLodNOnIdle();
+    }
+}
+
 bool KisImage::levelOfDetailBlocked() const
 {
     return m_d->blockLevelOfDetail;
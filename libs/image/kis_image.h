@@ -539,6 +539,19 @@ public:
      */
     KisPaintDeviceSP projection() const;
 
+    /**
+     * Returns a copy-on-write snapshot of the current projection.
+     * The copy shares all its tiles with the projection until either
+     * side is written to, so taking it costs O(tile metadata) and,
+     * unlike barrierLock(), never pauses the running strokes. The
+     * snapshot is consistent on the per-device level: tiles are
+     * captured atomically, but a stroke running concurrently may
+     * have finished in some regions and not in others. That is the
+     * right trade-off for thumbnails, overviews and autosave
+     * previews; exact exports should still use the barrier lock.
+     */
+    KisPaintDeviceSP createProjectionSnapshot() const;
+
     /**
      * Return the number of layers (not other nodes) that are in this
      * image.
@@ -737,6 +750,13 @@ public Q_SLOTS:
      */
     void explicitRegenerateLevelOfDetail();
 
+    /**
+     * Regenerate the lodN planes of the most recently used lod level
+     * in the background, while the image is idle. Called by the
+     * document's idle watcher.
+     */
+    void tryWarmUpLodNOnIdle();
+
 public:
 
     /**
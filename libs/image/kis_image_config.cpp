@@ -185,6 +185,32 @@ int KisImageConfig::poolLimit() const
     return totalRAM() * hp * pp;
 }
 
+bool KisImageConfig::useNumaAwareTilePooling(bool requestDefault) const
+{
+    return !requestDefault ?
+        m_config.readEntry("useNumaAwareTilePooling", false) : false;
+}
+
+void KisImageConfig::setUseNumaAwareTilePooling(bool value)
+{
+    m_config.writeEntry("useNumaAwareTilePooling", value);
+}
+
+qint64 KisImageConfig::parallelBitBltAreaThreshold(bool requestDefault) const
+{
+    // 1M pixels: roughly a 1024x1024 blit; below that the strip
+    // setup costs more than the parallelism wins
+    const qint64 defaultThreshold = 1024 * 1024;
+
+    return !requestDefault ?
+        m_config.readEntry("parallelBitBltAreaThreshold", defaultThreshold) : defaultThreshold;
+}
+
+void KisImageConfig::setParallelBitBltAreaThreshold(qint64 value)
+{
+    m_config.writeEntry("parallelBitBltAreaThreshold", value);
+}
+
 qreal KisImageConfig::memoryHardLimitPercent(bool requestDefault) const
 {
     return !requestDefault ?
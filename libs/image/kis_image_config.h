@@ -50,6 +50,12 @@ public:
     int tilesSoftLimit() const; // MiB
     int poolLimit() const; // MiB
 
+    bool useNumaAwareTilePooling(bool requestDefault = false) const;
+    void setUseNumaAwareTilePooling(bool value);
+
+    qint64 parallelBitBltAreaThreshold(bool requestDefault = false) const; // pixels
+    void setParallelBitBltAreaThreshold(qint64 value);
+
     qreal memoryHardLimitPercent(bool requestDefault = false) const; // % of total RAM
     qreal memorySoftLimitPercent(bool requestDefault = false) const; // % of memoryHardLimitPercent() * (1 - 0.01 * memoryPoolLimitPercent())
     qreal memoryPoolLimitPercent(bool requestDefault = false) const; // % of memoryHardLimitPercent()
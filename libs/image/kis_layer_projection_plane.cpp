@@ -8,8 +8,10 @@
 
 #include <QBitArray>
 #include <KoColorSpace.h>
+#include <KoColorSpaceConstants.h>
 #include <KoChannelInfo.h>
 #include <KoCompositeOpRegistry.h>
+#include "kis_paint_device.h"
 #include "kis_painter.h"
 #include "kis_projection_leaf.h"
 #include "kis_cached_paint_device.h"
@@ -102,7 +104,49 @@ void KisLayerProjectionPlane::applyImpl(KisPainter *painter, const QRect &rect,
     painter->setChannelFlags(channelFlags);
     painter->setCompositeOp(m_d->layer->compositeOpId());
     painter->setOpacity(m_d->layer->projectionLeaf()->opacity());
-    painter->bitBlt(needRect.topLeft(), device, needRect);
+
+    /**
+     * extent() is only a bounding rect: on a sparse layer most tiles
+     * inside it do not exist and compositing them is pure waste
+     * (the composite op runs over default-transparent pixels). For
+     * the composite modes where a transparent source is an identity
+     * operation we refine the blit to the tiles that actually exist.
+     * The per-tile region is a cheap metadata query on the data
+     * manager, so this pays off as soon as one tile can be skipped.
+     */
+    const QString compositeOpId = m_d->layer->compositeOpId();
+    const bool transparentSrcIsIdentity =
+        compositeOpId != COMPOSITE_COPY &&
+        compositeOpId != COMPOSITE_DESTINATION_IN &&
+        compositeOpId != COMPOSITE_DESTINATION_ATOP;
+
+    /**
+     * region() iterates all the tiles of the device, so the
+     * refinement only pays off on big rects (full refreshes,
+     * open-document recompositions); small stroke patches keep the
+     * single blit.
+     */
+    const qint64 minRefinedArea = 512 * 512;
+
+    if (transparentSrcIsIdentity && !maxOutAlpha &&
+        qint64(needRect.width()) * needRect.height() >= minRefinedArea &&
+        device->colorSpace()->opacityU8(device->defaultPixel().data()) == OPACITY_TRANSPARENT_U8) {
+
+        KisRegion deviceRegion = device->region();
+        deviceRegion &= needRect;
+        const QVector<QRect> tileRects = deviceRegion.rects();
+
+        if (tileRects.size() > 1) {
+            Q_FOREACH (const QRect &rc, tileRects) {
+                painter->bitBlt(rc.topLeft(), device, rc);
+            }
+        } else if (tileRects.size() == 1) {
+            painter->bitBlt(tileRects.first().topLeft(), device, tileRects.first());
+        }
+        // an empty region means the whole rect is transparent: skip
+    } else {
+        painter->bitBlt(needRect.topLeft(), device, needRect);
+    }
 
     if (maxOutAlpha) {
         m_d->cachedDevice.putDevice(device);
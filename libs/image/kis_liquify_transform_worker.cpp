@@ -6,6 +6,8 @@
 
 #include "kis_liquify_transform_worker.h"
 
+#include <QPainter>
+
 #include "kis_grid_interpolation_tools.h"
 #include "kis_dom_utils.h"
 #include "krita_utils.h"
@@ -477,10 +479,45 @@ QImage KisLiquifyTransformWorker::runOnQImage(const QImage &srcImage,
     QImage dstImage(dstBoundsI.size(), srcImage.format());
     dstImage.fill(0);
 
+    /**
+     * During interaction only the cells around the cursor are
+     * actually displaced. Pre-blit the source image as the identity
+     * result and let the grid iteration skip every cell whose
+     * polygon did not move, so dragging a liquify point costs
+     * proportionally to the brush size, not to the whole thumbnail.
+     */
+    {
+        QPainter gc(&dstImage);
+        gc.setCompositionMode(QPainter::CompositionMode_Source);
+        gc.drawImage(srcImageOffset - dstQImageOffset, srcImage);
+    }
+
+    struct SkipIdentityPolygonOp {
+        SkipIdentityPolygonOp(GridIterationTools::QImagePolygonOp &op)
+            : m_op(op)
+        {
+        }
+
+        void operator() (const QPolygonF &srcPolygon, const QPolygonF &dstPolygon) {
+            if (srcPolygon != dstPolygon) {
+                m_op(srcPolygon, dstPolygon);
+            }
+        }
+
+        void operator() (const QPolygonF &srcPolygon, const QPolygonF &dstPolygon, const QPolygonF &clipDstPolygon) {
+            if (srcPolygon != dstPolygon) {
+                m_op(srcPolygon, dstPolygon, clipDstPolygon);
+            }
+        }
+
+        GridIterationTools::QImagePolygonOp &m_op;
+    };
+
     GridIterationTools::QImagePolygonOp polygonOp(srcImage, dstImage, srcImageOffset, dstQImageOffset);
+    SkipIdentityPolygonOp skippingOp(polygonOp);
     GridIterationTools::RegularGridIndexesOp indexesOp(m_d->gridSize);
     GridIterationTools::iterateThroughGrid
-        <GridIterationTools::AlwaysCompletePolygonPolicy>(polygonOp, indexesOp,
+        <GridIterationTools::AlwaysCompletePolygonPolicy>(skippingOp, indexesOp,
                                                           m_d->gridSize,
                                                           originalPointsLocal,
                                                           transformedPointsLocal);
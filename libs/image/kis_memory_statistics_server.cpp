@@ -142,6 +142,7 @@ KisMemoryStatisticsServer::fetchMemoryStatistics(KisImageSP image) const
     stats.realMemorySize = tileStats.realMemorySize;
     stats.historicalMemorySize = tileStats.historicalMemorySize;
     stats.poolSize = tileStats.poolSize;
+    stats.sharedMemorySize = tileStats.sharedMemorySize;
 
     stats.swapSize = tileStats.swapSize;
 
@@ -31,6 +31,7 @@ public:
               realMemorySize(0),
               historicalMemorySize(0),
               poolSize(0),
+              sharedMemorySize(0),
 
               swapSize(0),
 
@@ -50,6 +51,7 @@ public:
         qint64 realMemorySize;
         qint64 historicalMemorySize;
         qint64 poolSize;
+        qint64 sharedMemorySize;
 
         qint64 swapSize;
 
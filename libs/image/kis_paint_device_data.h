@@ -8,6 +8,7 @@
 #define __KIS_PAINT_DEVICE_DATA_H
 
 #include "KoAlwaysInline.h"
+#include "KoColorConversionSession.h"
 #include "kundo2command.h"
 #include "kis_command_utils.h"
 
@@ -162,10 +163,18 @@ public:
 
         QRect rc = m_dataManager->region().boundingRect();
 
+        /**
+         * The session pins the cached lcms transformation once for
+         * the whole device instead of looking it up (under the cache
+         * mutex) for every span of the iterator.
+         */
+        KoColorConversionSession conversionSession(m_colorSpace, dstColorSpace,
+                                                   renderingIntent, conversionFlags);
+
         const int dstPixelSize = dstColorSpace->pixelSize();
         QScopedArrayPointer<quint8> dstDefaultPixel(new quint8[dstPixelSize]);
         memset(dstDefaultPixel.data(), 0, dstPixelSize);
-        m_colorSpace->convertPixelsTo(m_dataManager->defaultPixel(), dstDefaultPixel.data(), dstColorSpace, 1, renderingIntent, conversionFlags);
+        conversionSession.convert(m_dataManager->defaultPixel(), dstDefaultPixel.data(), 1);
 
         KisDataManagerSP dstDataManager = new KisDataManager(dstPixelSize, dstDefaultPixel.data());
 
@@ -187,10 +196,7 @@ public:
                 const quint8 *srcData = srcIt.rawDataConst();
                 quint8 *dstData = dstIt.rawData();
 
-                m_colorSpace->convertPixelsTo(srcData, dstData,
-                                              dstColorSpace,
-                                              nConseqPixels,
-                                              renderingIntent, conversionFlags);
+                conversionSession.convert(srcData, dstData, nConseqPixels);
             }
         }
 
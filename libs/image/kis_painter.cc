@@ -51,6 +51,10 @@
 #include "kis_lod_transform.h"
 #include "kis_algebra_2d.h"
 #include "krita_utils.h"
+#include "kis_image_config.h"
+
+#include <QtConcurrent>
+#include <QThread>
 
 
 // Maximum distance from a Bezier control point to the line through the start
@@ -657,6 +661,82 @@ void KisPainter::bitBltWithFixedSelection(qint32 dstX, qint32 dstY,
     bitBltWithFixedSelection(dstX, dstY, srcDev, selection, 0, 0, 0, 0, srcWidth, srcHeight);
 }
 
+namespace {
+
+/**
+ * Blits one horizontal strip with composite-op semantics identical to
+ * the serial loop in bitBltImpl(). All the state is local (own
+ * accessors and an own copy of the parameter info), so several strips
+ * can run on different threads as long as they don't share
+ * destination tiles.
+ */
+template <bool useOldSrcData>
+void bitBltStrip(KisPaintDeviceSP dstDev,
+                 const KisPaintDeviceSP srcDev,
+                 const KoColorSpace *dstColorSpace,
+                 const KoCompositeOp *compositeOp,
+                 KoColorConversionTransformation::Intent renderingIntent,
+                 KoColorConversionTransformation::ConversionFlags conversionFlags,
+                 KoCompositeOp::ParameterInfo paramInfo,
+                 qint32 dstX, qint32 dstY,
+                 qint32 srcX, qint32 srcY,
+                 qint32 srcWidth, qint32 srcHeight)
+{
+    qint32 dstY_ = dstY;
+    qint32 srcY_ = srcY;
+    qint32 rowsRemaining = srcHeight;
+
+    KisRandomConstAccessorSP srcIt = srcDev->createRandomConstAccessorNG();
+    KisRandomAccessorSP dstIt = dstDev->createRandomAccessorNG();
+
+    while (rowsRemaining > 0) {
+
+        qint32 dstX_ = dstX;
+        qint32 srcX_ = srcX;
+        qint32 columnsRemaining = srcWidth;
+        qint32 numContiguousDstRows = dstIt->numContiguousRows(dstY_);
+        qint32 numContiguousSrcRows = srcIt->numContiguousRows(srcY_);
+
+        qint32 rows = qMin(numContiguousDstRows, numContiguousSrcRows);
+        rows = qMin(rows, rowsRemaining);
+
+        while (columnsRemaining > 0) {
+
+            qint32 numContiguousDstColumns = dstIt->numContiguousColumns(dstX_);
+            qint32 numContiguousSrcColumns = srcIt->numContiguousColumns(srcX_);
+
+            qint32 columns = qMin(numContiguousDstColumns, numContiguousSrcColumns);
+            columns = qMin(columns, columnsRemaining);
+
+            qint32 srcRowStride = srcIt->rowStride(srcX_, srcY_);
+            srcIt->moveTo(srcX_, srcY_);
+
+            qint32 dstRowStride = dstIt->rowStride(dstX_, dstY_);
+            dstIt->moveTo(dstX_, dstY_);
+
+            paramInfo.dstRowStart   = dstIt->rawData();
+            paramInfo.dstRowStride  = dstRowStride;
+            paramInfo.srcRowStart   = useOldSrcData ? srcIt->oldRawData() : static_cast<KisRandomAccessor2*>(srcIt.data())->rawData();
+            paramInfo.srcRowStride  = srcRowStride;
+            paramInfo.maskRowStart  = 0;
+            paramInfo.maskRowStride = 0;
+            paramInfo.rows          = rows;
+            paramInfo.cols          = columns;
+            dstColorSpace->bitBlt(srcDev->colorSpace(), paramInfo, compositeOp, renderingIntent, conversionFlags);
+
+            srcX_ += columns;
+            dstX_ += columns;
+            columnsRemaining -= columns;
+        }
+
+        srcY_ += rows;
+        dstY_ += rows;
+        rowsRemaining -= rows;
+    }
+}
+
+}
+
 template <bool useOldSrcData>
 void KisPainter::bitBltImpl(qint32 dstX, qint32 dstY,
                             const KisPaintDeviceSP srcDev,
@@ -768,6 +848,67 @@ void KisPainter::bitBltImpl(qint32 dstX, qint32 dstY,
         }
     }
     else {
+        /**
+         * Big selection-less blits are split into horizontal strips
+         * processed in parallel. The strip boundaries are snapped to
+         * the tile grid of the destination device, so no destination
+         * tile is ever written by two threads at once.
+         */
+        static const qint64 areaThreshold =
+            KisImageConfig(true).parallelBitBltAreaThreshold();
+        const int idealNumThreads = QThread::idealThreadCount();
+
+        if (qint64(srcWidth) * srcHeight >= areaThreshold && idealNumThreads > 1) {
+
+            const qint32 tileAlignment = KisTileData::HEIGHT;
+            const qint32 stripHeight =
+                qMax(tileAlignment,
+                     (srcHeight + idealNumThreads - 1) / idealNumThreads);
+
+            struct Strip {
+                qint32 yOffset;
+                qint32 height;
+            };
+            QVector<Strip> strips;
+
+            qint32 processed = 0;
+            while (processed < srcHeight) {
+                qint32 end = processed + stripHeight;
+
+                if (end < srcHeight) {
+                    // snap the boundary to the dst tile grid
+                    end = ((dstY + end) & ~(tileAlignment - 1)) - dstY;
+                }
+                end = qMin(end, srcHeight);
+                KIS_SAFE_ASSERT_RECOVER_BREAK(end > processed);
+
+                strips.append({processed, end - processed});
+                processed = end;
+            }
+
+            if (processed == srcHeight) {
+                KisPaintDeviceSP dstDev = d->device;
+                const KoColorSpace *dstColorSpace = d->colorSpace;
+                const KoCompositeOp *compositeOp = d->compositeOp;
+                const KoColorConversionTransformation::Intent renderingIntent = d->renderingIntent;
+                const KoColorConversionTransformation::ConversionFlags conversionFlags = d->conversionFlags;
+                const KoCompositeOp::ParameterInfo paramInfo = d->paramInfo;
+
+                QtConcurrent::blockingMap(strips,
+                    [=] (const Strip &strip) {
+                        bitBltStrip<useOldSrcData>(dstDev, srcDev,
+                                                   dstColorSpace, compositeOp,
+                                                   renderingIntent, conversionFlags,
+                                                   paramInfo,
+                                                   dstX, dstY + strip.yOffset,
+                                                   srcX, srcY + strip.yOffset,
+                                                   srcWidth, strip.height);
+                    });
+
+                addDirtyRect(QRect(dstX, dstY, srcWidth, srcHeight));
+                return;
+            }
+        }
 
         while (rowsRemaining > 0) {
 
@@ -83,6 +83,10 @@ KisRegenerateFrameStrokeStrategy::KisRegenerateFrameStrokeStrategy(int frameId,
     enableJob(JOB_FINISH, true, KisStrokeJobData::BARRIER);
     enableJob(JOB_CANCEL, true, KisStrokeJobData::BARRIER);
 
+    // pure background processing: let interactive strokes queue up
+    // in front of us while we have not started yet
+    setPriority(100);
+
     enableJob(JOB_DOSTROKE);
 
     enableJob(JOB_SUSPEND);
@@ -107,6 +111,10 @@ KisRegenerateFrameStrokeStrategy::KisRegenerateFrameStrokeStrategy(KisImageAnima
     enableJob(JOB_FINISH, true, KisStrokeJobData::BARRIER);
     enableJob(JOB_CANCEL, true, KisStrokeJobData::BARRIER);
 
+    // pure background processing: let interactive strokes queue up
+    // in front of us while we have not started yet
+    setPriority(100);
+
     enableJob(JOB_SUSPEND);
     enableJob(JOB_RESUME);
 
@@ -12,6 +12,7 @@
 #include "kis_image_config.h"
 #include "kis_full_refresh_walker.h"
 #include "kis_spontaneous_job.h"
+#include "KisRegion.h"
 
 
 //#define ENABLE_DEBUG_JOIN
@@ -77,6 +78,11 @@ int KisSimpleUpdateQueue::overrideLevelOfDetail() const
 
 void KisSimpleUpdateQueue::processQueue(KisUpdaterContext &updaterContext)
 {
+    {
+        QMutexLocker locker(&m_lock);
+        splitOversizedWalkers();
+    }
+
     updaterContext.lock();
 
     while(updaterContext.hasSpareThread() &&
@@ -85,6 +91,68 @@ void KisSimpleUpdateQueue::processQueue(KisUpdaterContext &updaterContext)
     updaterContext.unlock();
 }
 
+void KisSimpleUpdateQueue::splitOversizedWalkers()
+{
+    /**
+     * New jobs are split into patches on enqueue (trySplitJob), but
+     * the merge/collect optimization can grow a walker far beyond
+     * the patch size again. Such a walker would keep a single worker
+     * busy while the others idle at the tail of a recomposition, so
+     * re-split it along the patch grid right before dispatching.
+     * The patch walkers are inserted directly into the list (not via
+     * addJob()), otherwise the merge pass would just join them back.
+     */
+    const qint64 maxWalkerArea = 4 * qint64(m_patchWidth) * m_patchHeight;
+
+    KisMutableWalkersListIterator iter(m_updatesList);
+
+    while (iter.hasNext()) {
+        KisBaseRectsWalkerSP item = iter.next();
+        const QRect rc = item->requestedRect();
+
+        if (qint64(rc.width()) * rc.height() <= maxWalkerArea) continue;
+        if (rc.width() <= m_patchWidth && rc.height() <= m_patchHeight) continue;
+
+        const KisBaseRectsWalker::UpdateType type = item->type();
+        if (type != KisBaseRectsWalker::UPDATE &&
+            type != KisBaseRectsWalker::UPDATE_NO_FILTHY &&
+            type != KisBaseRectsWalker::FULL_REFRESH) {
+
+            continue;
+        }
+
+        iter.remove();
+
+        const qint32 firstCol = rc.x() / m_patchWidth;
+        const qint32 firstRow = rc.y() / m_patchHeight;
+        const qint32 lastCol = (rc.x() + rc.width()) / m_patchWidth;
+        const qint32 lastRow = (rc.y() + rc.height()) / m_patchHeight;
+
+        for (qint32 i = firstRow; i <= lastRow; i++) {
+            for (qint32 j = firstCol; j <= lastCol; j++) {
+                const QRect patchRect =
+                    rc & QRect(j * m_patchWidth, i * m_patchHeight,
+                               m_patchWidth, m_patchHeight);
+
+                if (patchRect.isEmpty()) continue;
+
+                KisBaseRectsWalkerSP walker;
+
+                if (type == KisBaseRectsWalker::UPDATE) {
+                    walker = new KisMergeWalker(item->cropRect(), KisMergeWalker::DEFAULT);
+                } else if (type == KisBaseRectsWalker::FULL_REFRESH) {
+                    walker = new KisFullRefreshWalker(item->cropRect());
+                } else {
+                    walker = new KisMergeWalker(item->cropRect(), KisMergeWalker::NO_FILTHY);
+                }
+
+                walker->collectRects(item->startNode(), patchRect);
+                iter.insert(walker);
+            }
+        }
+    }
+}
+
 bool KisSimpleUpdateQueue::processOneJob(KisUpdaterContext &updaterContext)
 {
     QMutexLocker locker(&m_lock);
@@ -176,7 +244,22 @@ void KisSimpleUpdateQueue::addJob(KisNodeSP node, const QVector<QRect> &rects,
 {
     QList<KisBaseRectsWalkerSP> walkers;
 
-    Q_FOREACH (const QRect &rc, rects) {
+    /**
+     * Spray-like brushes deliver hundreds of tiny rects per update;
+     * each of them used to run its own merge scan over the queue
+     * under the lock, which made the merge pass itself show up in
+     * the profiles. Coalesce the incoming batch against itself first
+     * (on the caller thread, without the lock), so the per-rect
+     * passes below see a handful of merged rects instead.
+     */
+    QVector<QRect> effectiveRects = rects;
+
+    if (effectiveRects.size() > 4) {
+        static const int coalescingGridSize = 64;
+        KisRegion::approximateOverlappingRects(effectiveRects, coalescingGridSize);
+    }
+
+    Q_FOREACH (const QRect &rc, effectiveRects) {
         if (rc.isEmpty()) continue;
 
         KisBaseRectsWalkerSP walker;
@@ -260,6 +260,11 @@ bool KisStroke::canForgetAboutMe() const
     return m_strokeStrategy->canForgetAboutMe();
 }
 
+int KisStroke::priority() const
+{
+    return m_strokeStrategy->priority();
+}
+
 qreal KisStroke::balancingRatioOverride() const
 {
     return m_strokeStrategy->balancingRatioOverride();
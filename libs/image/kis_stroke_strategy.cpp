@@ -17,6 +17,7 @@ KisStrokeStrategy::KisStrokeStrategy(const QLatin1String &id, const KUndo2MagicS
       m_requestsOtherStrokesToEnd(true),
       m_canForgetAboutMe(false),
       m_needsExplicitCancel(false),
+      m_priority(0),
       m_balancingRatioOverride(-1.0),
       m_id(id),
       m_name(name),
@@ -31,6 +32,7 @@ KisStrokeStrategy::KisStrokeStrategy(const KisStrokeStrategy &rhs)
       m_requestsOtherStrokesToEnd(rhs.m_requestsOtherStrokesToEnd),
       m_canForgetAboutMe(rhs.m_canForgetAboutMe),
       m_needsExplicitCancel(rhs.m_needsExplicitCancel),
+      m_priority(rhs.m_priority),
       m_balancingRatioOverride(rhs.m_balancingRatioOverride),
       m_id(rhs.m_id),
       m_name(rhs.m_name),
@@ -213,3 +215,13 @@ void KisStrokeStrategy::setBalancingRatioOverride(qreal value)
 {
     m_balancingRatioOverride = value;
 }
+
+int KisStrokeStrategy::priority() const
+{
+    return m_priority;
+}
+
+void KisStrokeStrategy::setPriority(int value)
+{
+    m_priority = value;
+}
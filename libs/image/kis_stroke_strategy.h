@@ -92,6 +92,15 @@ public:
 
     bool needsExplicitCancel() const;
 
+    /**
+     * The priority class of the stroke. 0 (the default) is for
+     * interactive work; strategies doing background processing
+     * (e.g. animation cache regeneration) report a higher value,
+     * which lets freshly started interactive strokes be queued in
+     * front of them as long as they have not started executing yet.
+     */
+    int priority() const;
+
     /**
      * \see setBalancingRatioOverride() for details
      */
@@ -138,6 +147,7 @@ protected:
     void setExclusive(bool value);
     void setSupportsWrapAroundMode(bool value);
     void setClearsRedoOnStart(bool value);
+    void setPriority(int value);
     void setRequestsOtherStrokesToEnd(bool value);
     void setCanForgetAboutMe(bool value);
     void setNeedsExplicitCancel(bool value);
@@ -170,6 +180,7 @@ private:
     bool m_requestsOtherStrokesToEnd;
     bool m_canForgetAboutMe;
     bool m_needsExplicitCancel;
+    int m_priority;
     qreal m_balancingRatioOverride;
 
     QLatin1String m_id;
@@ -68,6 +68,8 @@ struct Q_DECL_HIDDEN KisStrokesQueue::Private {
           currentStrokeLoaded(false),
           lodNNeedsSynchronization(true),
           desiredLevelOfDetail(0),
+          lodNWarmLevel(0),
+          lastRequestedLevelOfDetail(0),
           nextDesiredLevelOfDetail(0),
           lodNStrokesFacade(_q),
           lodNPostExecutionUndoAdapter(&lodNUndoStore, &lodNStrokesFacade) {}
@@ -82,6 +84,8 @@ struct Q_DECL_HIDDEN KisStrokesQueue::Private {
 
     bool lodNNeedsSynchronization;
     int desiredLevelOfDetail;
+    int lodNWarmLevel;
+    int lastRequestedLevelOfDetail;
     int nextDesiredLevelOfDetail;
     QMutex mutex;
     KisLodSyncStrokeStrategyFactory lod0ToNStrokeStrategyFactory;
@@ -147,6 +151,7 @@ void KisStrokesQueue::Private::startLod0ToNStroke(int levelOfDetail, bool forget
     executeStrokePair(syncPair, this->strokesQueue, this->strokesQueue.end(),  KisStroke::LODN, levelOfDetail, q);
 
     this->lodNNeedsSynchronization = false;
+    this->lodNWarmLevel = levelOfDetail;
 }
 
 void KisStrokesQueue::Private::cancelForgettableStrokes()
@@ -292,7 +297,37 @@ KisStrokeId KisStrokesQueue::startStroke(KisStrokeStrategy *strokeStrategy)
 
     } else {
         stroke = KisStrokeSP(new KisStroke(strokeStrategy, KisStroke::LEGACY, 0));
-        m_d->strokesQueue.enqueue(stroke);
+
+        /**
+         * Interactive strokes may jump ahead of queued background
+         * strokes (higher priority value), as long as those have not
+         * started executing yet; this keeps the first dab of a brush
+         * stroke from waiting behind e.g. animation cache
+         * regeneration. Strokes of the same class keep strict FIFO
+         * order.
+         */
+        StrokesQueueIterator it = m_d->strokesQueue.end();
+
+        while (it != m_d->strokesQueue.begin()) {
+            /**
+             * Never jump over the head of the queue: only the head
+             * stroke can have jobs in flight, and overlapping with
+             * it would break the strict stroke ordering.
+             */
+            if (it - 1 == m_d->strokesQueue.begin()) break;
+
+            KisStrokeSP prevStroke = *(it - 1);
+
+            if (prevStroke->isInitialized() ||
+                prevStroke->priority() <= stroke->priority()) {
+
+                break;
+            }
+
+            --it;
+        }
+
+        m_d->strokesQueue.insert(it, stroke);
     }
 
     KisStrokeId id(stroke);
@@ -572,10 +607,21 @@ void KisStrokesQueue::Private::switchDesiredLevelOfDetail(bool forced)
             forced && !lodNNeedsSynchronization &&
             desiredLevelOfDetail == nextDesiredLevelOfDetail;
 
+        /**
+         * If the idle-time warm-up task has already synchronized the
+         * planes for exactly this level and nothing invalidated them
+         * since, entering the lod mode needs no regeneration at all.
+         */
+        const bool warmFromIdleTask =
+            !forced &&
+            !lodNNeedsSynchronization &&
+            desiredLevelOfDetail == 0 &&
+            lodNWarmLevel == nextDesiredLevelOfDetail;
+
         desiredLevelOfDetail = nextDesiredLevelOfDetail;
-        lodNNeedsSynchronization |= !forgettable;
+        lodNNeedsSynchronization |= !forgettable && !warmFromIdleTask;
 
-        if (desiredLevelOfDetail) {
+        if (desiredLevelOfDetail && !warmFromIdleTask) {
             startLod0ToNStroke(desiredLevelOfDetail, forgettable);
         }
     }
@@ -587,12 +633,36 @@ void KisStrokesQueue::explicitRegenerateLevelOfDetail()
     m_d->switchDesiredLevelOfDetail(true);
 }
 
+void KisStrokesQueue::tryWarmUpLodNOnIdle()
+{
+    QMutexLocker locker(&m_d->mutex);
+
+    /**
+     * An idle-time task: synchronize the lodN planes for the level
+     * the user worked with most recently, so that the next switch to
+     * instant preview or a zoomed-out view finds a warm pyramid. Do
+     * nothing while a lod level is active (the normal machinery
+     * handles that), while the planes are warm already, or while any
+     * stroke is still queued: idle means idle.
+     */
+    if (m_d->desiredLevelOfDetail) return;
+    if (!m_d->lodNNeedsSynchronization) return;
+    if (!m_d->lastRequestedLevelOfDetail) return;
+    if (!m_d->strokesQueue.isEmpty()) return;
+
+    m_d->startLod0ToNStroke(m_d->lastRequestedLevelOfDetail, false);
+}
+
 void KisStrokesQueue::setDesiredLevelOfDetail(int lod)
 {
     QMutexLocker locker(&m_d->mutex);
 
     if (lod == m_d->nextDesiredLevelOfDetail) return;
 
+    if (lod > 0) {
+        m_d->lastRequestedLevelOfDetail = lod;
+    }
+
     m_d->nextDesiredLevelOfDetail = lod;
     m_d->switchDesiredLevelOfDetail(false);
 }
@@ -55,6 +55,7 @@ public:
 
     void setDesiredLevelOfDetail(int lod);
     void explicitRegenerateLevelOfDetail();
+    void tryWarmUpLodNOnIdle();
     void setLod0ToNStrokeStrategyFactory(const KisLodSyncStrokeStrategyFactory &factory);
     void setSuspendResumeUpdatesStrokeStrategyFactory(const KisSuspendResumeStrategyPairFactory &factory);
     KisPostExecutionUndoAdapter* lodNPostExecutionUndoAdapter() const;
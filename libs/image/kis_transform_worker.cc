@@ -10,6 +10,9 @@
 
 #include "kis_transform_worker.h"
 
+#include <QtConcurrent>
+#include <QThread>
+
 #include <qmath.h>
 #include <klocalizedstring.h>
 
@@ -195,19 +198,76 @@ void KisTransformWorker::transformPass(KisPaintDevice *src, KisPaintDevice *dst,
     calcDimensions<T>(m_boundRect, srcStart, srcLen, firstLine, numLines);
 
     KisProgressUpdateHelper progressHelper(m_progressUpdater, portion, numLines);
-    KisFilterWeightsBuffer buf(filterStrategy, qAbs(floatscale));
+    KisFilterWeightsBufferSP bufferSP =
+        KisCachedFilterWeightsBuffer::fetch(filterStrategy, qAbs(floatscale));
+    KisFilterWeightsBuffer &buf = *bufferSP;
     KisFilterWeightsApplicator applicator(src, dst, floatscale, shear, dx, clampToEdge);
 
     KisFilterWeightsApplicator::LinePos dstBounds;
 
-    for (int i = firstLine; i < firstLine + numLines; i++) {
-        KisFilterWeightsApplicator::LinePos dstPos;
-        KisFilterWeightsApplicator::LinePos srcPos(srcStart, srcLen);
+    const qreal filterSupport = filterStrategy->support(buf.weightsPositionScale().toFloat());
+
+    /**
+     * The lines of one pass are completely independent (each source
+     * line maps onto the same destination line), so they can be
+     * processed in parallel. The strips are aligned to the tile grid
+     * so no destination tile is shared between threads; the weights
+     * buffer is read-only after construction and every strip gets
+     * its own applicator (and therefore its own accessors).
+     */
+    const int tileAlignment = 64;
+    const int idealNumThreads = QThread::idealThreadCount();
+
+    if (numLines >= 2 * tileAlignment && idealNumThreads > 1) {
+        struct Strip {
+            int firstLine;
+            int numLines;
+        };
+        QVector<Strip> strips;
+
+        int processed = firstLine;
+        const int lastLine = firstLine + numLines;
+
+        while (processed < lastLine) {
+            int end = qMin(lastLine, (processed + tileAlignment) & ~(tileAlignment - 1));
+            if (end <= processed) {
+                end = qMin(lastLine, processed + tileAlignment);
+            }
+            strips.append({processed, end - processed});
+            processed = end;
+        }
+
+        const QVector<KisFilterWeightsApplicator::LinePos> stripBounds =
+            QtConcurrent::blockingMapped(strips,
+                [&] (const Strip &strip) {
+                    KisFilterWeightsApplicator stripApplicator(src, dst, floatscale, shear, dx, clampToEdge);
+                    KisFilterWeightsApplicator::LinePos bounds;
 
-        dstPos = applicator.processLine<T>(srcPos, i, &buf, filterStrategy->support(buf.weightsPositionScale().toFloat()));
-        dstBounds.unite(dstPos);
+                    for (int i = strip.firstLine; i < strip.firstLine + strip.numLines; i++) {
+                        KisFilterWeightsApplicator::LinePos srcPos(srcStart, srcLen);
+                        bounds.unite(stripApplicator.processLine<T>(srcPos, i, &buf, filterSupport));
+                    }
 
-        progressHelper.step();
+                    return bounds;
+                });
+
+        Q_FOREACH (const KisFilterWeightsApplicator::LinePos &pos, stripBounds) {
+            dstBounds.unite(pos);
+        }
+
+        for (int i = 0; i < numLines; i++) {
+            progressHelper.step();
+        }
+    } else {
+        for (int i = firstLine; i < firstLine + numLines; i++) {
+            KisFilterWeightsApplicator::LinePos dstPos;
+            KisFilterWeightsApplicator::LinePos srcPos(srcStart, srcLen);
+
+            dstPos = applicator.processLine<T>(srcPos, i, &buf, filterSupport);
+            dstBounds.unite(dstPos);
+
+            progressHelper.step();
+        }
     }
 
     updateBounds<T>(m_boundRect, dstBounds);
@@ -8,6 +8,7 @@
 #define __KIS_UPDATE_JOB_ITEM_H
 
 #include <atomic>
+#include "KisChromeTraceRecorder.h"
 
 #include <QRunnable>
 #include <QReadWriteLock>
@@ -71,11 +72,15 @@ public:
             }
 
             if(m_atomicType == Type::MERGE) {
+                KIS_TRACE_SCOPE("merge job");
                 runMergeJob();
             } else {
                 KIS_ASSERT(m_atomicType == Type::STROKE ||
                            m_atomicType == Type::SPONTANEOUS);
 
+                KIS_TRACE_SCOPE(m_atomicType == Type::STROKE ?
+                                "stroke job" : "spontaneous job");
+
                 if (m_runnableJob) {
 #ifdef DEBUG_JOBS_SEQUENCE
                     if (m_atomicType == Type::STROKE) {
@@ -259,6 +259,12 @@ void KisUpdateScheduler::explicitRegenerateLevelOfDetail()
     processQueues();
 }
 
+void KisUpdateScheduler::tryWarmUpLodNOnIdle()
+{
+    m_d->strokesQueue.tryWarmUpLodNOnIdle();
+    processQueues();
+}
+
 int KisUpdateScheduler::currentLevelOfDetail() const
 {
     int levelOfDetail = m_d->updaterContext.currentLevelOfDetail();
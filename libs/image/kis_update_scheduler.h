@@ -153,6 +153,13 @@ public:
      */
     void explicitRegenerateLevelOfDetail();
 
+    /**
+     * Synchronize the lodN planes of the most recently used lod
+     * level in the background while the scheduler is idle.
+     * \see KisStrokesQueue::tryWarmUpLodNOnIdle()
+     */
+    void tryWarmUpLodNOnIdle();
+
     /**
      * Install a factory of a stroke strategy, that will be started
      * every time when the scheduler needs to synchronize LOD caches
@@ -240,13 +240,89 @@ void KisWarpTransformWorker::run()
 
     const QRect srcBounds = srcdev->region().boundingRect();
 
-    m_dev->clear();
-
     const int pixelPrecision = 8;
 
     FunctionTransformOp functionOp(m_warpMathFunction, m_origPoint, m_transfPoint, m_alpha);
+
+    /**
+     * Control points usually deform only a small part of the canvas,
+     * so instead of clearing the device and re-rendering every grid
+     * cell, collect the cells that actually move first. The cells
+     * whose destination quad equals the source quad (within a
+     * sub-pixel epsilon) keep their original content untouched; only
+     * the union of the moved cells' source rects is cleared and
+     * re-rendered. The destination quads of a grid tile the plane,
+     * so a moved quad can never overlap the rect of a skipped
+     * identity cell.
+     */
+    struct IdentityCellTest {
+        static bool isIdentity(const QPolygonF &srcPolygon, const QPolygonF &dstPolygon) {
+            static const qreal eps = 1e-4;
+
+            if (srcPolygon.size() != dstPolygon.size()) return false;
+
+            for (int i = 0; i < srcPolygon.size(); i++) {
+                const QPointF delta = srcPolygon[i] - dstPolygon[i];
+                if (qAbs(delta.x()) > eps || qAbs(delta.y()) > eps) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    struct CollectMovedCellsOp {
+        void operator() (const QPolygonF &srcPolygon, const QPolygonF &dstPolygon) {
+            this->operator() (srcPolygon, dstPolygon, dstPolygon);
+        }
+
+        void operator() (const QPolygonF &srcPolygon, const QPolygonF &dstPolygon, const QPolygonF &clipDstPolygon) {
+            Q_UNUSED(clipDstPolygon);
+
+            if (!IdentityCellTest::isIdentity(srcPolygon, dstPolygon)) {
+                movedSrcRects.append(srcPolygon.boundingRect().toAlignedRect());
+            }
+        }
+
+        QVector<QRect> movedSrcRects;
+    };
+
+    CollectMovedCellsOp collectOp;
+    GridIterationTools::processGrid(collectOp, functionOp,
+                                    srcBounds, pixelPrecision);
+
+    // nothing is deformed at all
+    if (collectOp.movedSrcRects.isEmpty()) return;
+
+    Q_FOREACH (const QRect &rc, collectOp.movedSrcRects) {
+        m_dev->clear(rc);
+    }
+
+    struct SkipIdentityPolygonOp {
+        SkipIdentityPolygonOp(GridIterationTools::PaintDevicePolygonOp &op)
+            : m_op(op)
+        {
+        }
+
+        void operator() (const QPolygonF &srcPolygon, const QPolygonF &dstPolygon) {
+            if (!IdentityCellTest::isIdentity(srcPolygon, dstPolygon)) {
+                m_op(srcPolygon, dstPolygon);
+            }
+        }
+
+        void operator() (const QPolygonF &srcPolygon, const QPolygonF &dstPolygon, const QPolygonF &clipDstPolygon) {
+            if (!IdentityCellTest::isIdentity(srcPolygon, dstPolygon)) {
+                m_op(srcPolygon, dstPolygon, clipDstPolygon);
+            }
+        }
+
+        GridIterationTools::PaintDevicePolygonOp &m_op;
+    };
+
     GridIterationTools::PaintDevicePolygonOp polygonOp(srcdev, m_dev);
-    GridIterationTools::processGrid(polygonOp, functionOp,
+    SkipIdentityPolygonOp skippingOp(polygonOp);
+    GridIterationTools::processGrid(skippingOp, functionOp,
                                     srcBounds, pixelPrecision);
 }
 
@@ -7,6 +7,8 @@
 
 #include "KisTiledExtentManager.h"
 
+#include <atomic>
+
 #include <QMutex>
 #include <QVector>
 #include "kis_tile_data_interface.h"
@@ -249,6 +251,18 @@ KisTiledExtentManager::KisTiledExtentManager()
     m_currentExtent = QRect();
 }
 
+void KisTiledExtentManager::setCurrentExtent(const QRect &extent)
+{
+    /**
+     * The caller must hold m_extentLock for write, which serializes
+     * the writers, so a simple odd/even flip of the sequence number
+     * is enough for the lock-free readers in extent().
+     */
+    m_extentSeqNo.fetchAndAddOrdered(1);
+    m_currentExtent = extent;
+    m_extentSeqNo.fetchAndAddOrdered(1);
+}
+
 void KisTiledExtentManager::notifyTileAdded(qint32 col, qint32 row)
 {
     bool needsUpdateExtent = false;
@@ -294,11 +308,40 @@ void KisTiledExtentManager::clear()
     m_rowsData.clear();
 
     QWriteLocker lock(&m_extentLock);
-    m_currentExtent = QRect();
+    setCurrentExtent(QRect());
 }
 
 QRect KisTiledExtentManager::extent() const
 {
+    /**
+     * Seqlock read path: never takes m_extentLock, so concurrent
+     * stroke writers calling updateExtent() are not blocked by
+     * extent() polling from the mergers.
+     */
+    const int maxSpins = 50;
+
+    for (int i = 0; i < maxSpins; i++) {
+        const int seqNo = m_extentSeqNo.loadAcquire();
+
+        if (seqNo & 1) continue;
+
+        const QRect extent = m_currentExtent;
+
+        /**
+         * The revalidation load alone does not keep the preceding
+         * non-atomic QRect loads from sinking below it on a
+         * weakly-ordered CPU (or under compiler reordering); the
+         * acquire fence pins them, which is the standard seqlock
+         * reader shape.
+         */
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (m_extentSeqNo.loadAcquire() == seqNo) {
+            return extent;
+        }
+    }
+
+    // the writers are too active, fall back to the blocking path
     QReadLocker lock(&m_extentLock);
     return m_currentExtent;
 }
@@ -332,5 +375,5 @@ void KisTiledExtentManager::updateExtent()
     }
 
     QWriteLocker lock(&m_extentLock);
-    m_currentExtent = QRect(minX, minY, width, height);
+    setCurrentExtent(QRect(minX, minY, width, height));
 }
@@ -10,6 +10,7 @@
 
 #include <QMutex>
 #include <QReadWriteLock>
+#include <QAtomicInt>
 #include <QMap>
 #include <QRect>
 #include "kritaimage_export.h"
@@ -64,10 +65,20 @@ public:
 
 private:
     void updateExtent();
+    void setCurrentExtent(const QRect &extent);
     friend class KisTiledDataManagerTest;
 
 private:
     mutable QReadWriteLock m_extentLock;
+
+    /**
+     * The extent is published through a seqlock, so that extent()
+     * readers (e.g. the merger threads) never block concurrent
+     * writers. The sequence number is odd while a writer is in
+     * progress; readers retry on a torn value and fall back to
+     * m_extentLock only when the writers keep them starving.
+     */
+    QAtomicInt m_extentSeqNo;
     QRect m_currentExtent;
     Data m_colsData;
     Data m_rowsData;
@@ -6,6 +6,8 @@
 
 #include "kis_hline_iterator.h"
 
+#include <QVarLengthArray>
+
 
 KisHLineIterator2::KisHLineIterator2(KisDataManager *dataManager, qint32 x, qint32 y, qint32 w, qint32 offsetX, qint32 offsetY, bool writable, KisIteratorCompleteListener *competionListener)
     : KisBaseIterator(dataManager, writable, competionListener),
@@ -46,9 +48,8 @@ KisHLineIterator2::KisHLineIterator2(KisDataManager *dataManager, qint32 x, qint
     m_tileWidth = m_pixelSize * KisTileData::HEIGHT;
 
     // let's preallocate first row
-    for (quint32 i = 0; i < m_tilesCacheSize; i++){
-        fetchTileDataForCache(m_tilesCache[i], m_leftCol + i, m_row);
-    }
+    fetchTileRowDataForCache();
+
     m_index = 0;
     switchToTile(m_leftInLeftmostTile);
 }
@@ -199,13 +200,41 @@ void KisHLineIterator2::fetchTileDataForCache(KisTileInfo& kti, qint32 col, qint
     kti.oldData = kti.oldtile->data();
 }
 
+void KisHLineIterator2::fetchTileRowDataForCache()
+{
+    /**
+     * Pin the whole tile row with a single traversal of the hash
+     * table instead of paying the per-tile lookup cost for every
+     * 64-pixel column.
+     */
+    QVarLengthArray<KisTileSP, 64> tiles(m_tilesCacheSize);
+    QVarLengthArray<KisTileSP, 64> oldTiles(m_tilesCacheSize);
+
+    m_dataManager->getTilesRowPair(m_leftCol, m_rightCol, m_row, m_writable,
+                                   tiles.data(), oldTiles.data());
+
+    for (quint32 i = 0; i < m_tilesCacheSize; i++) {
+        KisTileInfo &kti = m_tilesCache[i];
+
+        kti.tile = tiles[i];
+        kti.oldtile = oldTiles[i];
+
+        lockTile(kti.tile);
+        kti.data = kti.tile->data();
+
+        lockOldTile(kti.oldtile);
+        kti.oldData = kti.oldtile->data();
+    }
+}
+
 void KisHLineIterator2::preallocateTiles()
 {
     for (quint32 i = 0; i < m_tilesCacheSize; ++i){
         unlockTile(m_tilesCache[i].tile);
         unlockOldTile(m_tilesCache[i].oldtile);
-        fetchTileDataForCache(m_tilesCache[i], m_leftCol + i, m_row);
     }
+
+    fetchTileRowDataForCache();
 }
 
 qint32 KisHLineIterator2::x() const
@@ -72,6 +72,7 @@ private:
 
     void switchToTile(qint32 xInTile);
     void fetchTileDataForCache(KisTileInfo& kti, qint32 col, qint32 row);
+    void fetchTileRowDataForCache();
     void preallocateTiles();
 };
 #endif
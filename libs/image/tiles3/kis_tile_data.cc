@@ -13,19 +13,38 @@
 
 #include <boost/pool/singleton_pool.hpp>
 #include "kis_tile_data_store_iterators.h"
+#include "kis_image_config.h"
+
+#ifdef Q_OS_LINUX
+#include <QDir>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 // BPP == bytes per pixel
 #define TILE_SIZE_4BPP (4 * __TILE_DATA_WIDTH * __TILE_DATA_HEIGHT)
 #define TILE_SIZE_8BPP (8 * __TILE_DATA_WIDTH * __TILE_DATA_HEIGHT)
+#define TILE_SIZE_16BPP (16 * __TILE_DATA_WIDTH * __TILE_DATA_HEIGHT)
 
+/**
+ * The 16BPP pool serves the float32 color spaces, which dominate
+ * high-bit-depth painting sessions; letting them go through the
+ * general heap fragmented it badly over long sessions.
+ */
 typedef boost::singleton_pool<KisTileData, TILE_SIZE_4BPP, boost::default_user_allocator_new_delete, boost::details::pool::default_mutex, 256, 4096> BoostPool4BPP;
 typedef boost::singleton_pool<KisTileData, TILE_SIZE_8BPP, boost::default_user_allocator_new_delete, boost::details::pool::default_mutex, 128, 2048> BoostPool8BPP;
+typedef boost::singleton_pool<KisTileData, TILE_SIZE_16BPP, boost::default_user_allocator_new_delete, boost::details::pool::default_mutex, 64, 1024> BoostPool16BPP;
+
+QAtomicInt KisTileData::m_numLivePooledAllocations[KisTileData::NUM_POOL_CLASSES];
+QAtomicInt KisTileData::m_peakPooledAllocations[KisTileData::NUM_POOL_CLASSES];
 
 const qint32 KisTileData::WIDTH = __TILE_DATA_WIDTH;
 const qint32 KisTileData::HEIGHT = __TILE_DATA_HEIGHT;
 
 SimpleCache KisTileData::m_cache;
 
+int SimpleCache::m_numPools = 1;
+
 SimpleCache::~SimpleCache()
 {
     clear();
@@ -36,17 +55,67 @@ void SimpleCache::clear()
     QWriteLocker l(&m_cacheLock);
     quint8 *ptr = 0;
 
-    while (m_4Pool.pop(ptr)) {
-        BoostPool4BPP::free(ptr);
-    }
+    for (int i = 0; i < MAX_NUMA_POOLS; i++) {
+        while (m_4Pool[i].pop(ptr)) {
+            BoostPool4BPP::free(ptr);
+        }
+
+        while (m_8Pool[i].pop(ptr)) {
+            BoostPool8BPP::free(ptr);
+        }
 
-    while (m_8Pool.pop(ptr)) {
-        BoostPool8BPP::free(ptr);
+        while (m_16Pool[i].pop(ptr)) {
+            BoostPool16BPP::free(ptr);
+        }
     }
+}
+
+int SimpleCache::poolIndex()
+{
+#ifdef Q_OS_LINUX
+    if (m_numPools > 1) {
+        /**
+         * getcpu() is vdso-accelerated but still not free, so cache
+         * the node per-thread and refresh it only once in a while.
+         * Threads migrate rarely enough that a slightly stale node
+         * only costs us one remote steal later.
+         */
+        static const int refreshPeriod = 256;
+        thread_local int cachedNode = -1;
+        thread_local int refreshCounter = 0;
+
+        if (cachedNode < 0 || ++refreshCounter >= refreshPeriod) {
+            refreshCounter = 0;
+            unsigned node = 0;
+            if (syscall(SYS_getcpu, nullptr, &node, nullptr) == 0) {
+                cachedNode = qMin(int(node), m_numPools - 1);
+            } else {
+                cachedNode = 0;
+            }
+        }
 
-    while (m_16Pool.pop(ptr)) {
-        free(ptr);
+        return cachedNode;
     }
+#endif
+    return 0;
+}
+
+void SimpleCache::initNumaTopology()
+{
+#ifdef Q_OS_LINUX
+    if (!KisImageConfig(true).useNumaAwareTilePooling()) return;
+
+    /**
+     * We don't link against libnuma, so fetch the number of online
+     * nodes straight from sysfs. On non-NUMA machines exactly one
+     * node is reported and the cache keeps its old behavior.
+     */
+    const QStringList nodes =
+        QDir("/sys/devices/system/node")
+            .entryList(QStringList() << "node*", QDir::Dirs);
+
+    m_numPools = qBound(1, nodes.size(), MAX_NUMA_POOLS);
+#endif
 }
 
 
@@ -104,10 +173,36 @@ KisTileData::~KisTileData()
 
 void KisTileData::fillWithPixel(const quint8 *defPixel)
 {
-    quint8 *it = m_data;
+    const qint32 pixelSize = m_pixelSize;
+    const qint64 tileSize = qint64(WIDTH) * HEIGHT * pixelSize;
+
+    /**
+     * This is the hot path of every tile creation, so avoid the
+     * per-pixel loop: a constant byte pattern becomes one memset,
+     * everything else is filled by doubling the already-filled
+     * prefix, so the bulk of the work runs through the vectorized
+     * memcpy of the libc.
+     */
+    bool allBytesTheSame = true;
+    for (qint32 i = 1; i < pixelSize; i++) {
+        if (defPixel[i] != defPixel[0]) {
+            allBytesTheSame = false;
+            break;
+        }
+    }
 
-    for (int i = 0; i < WIDTH * HEIGHT; i++, it += m_pixelSize) {
-        memcpy(it, defPixel, m_pixelSize);
+    if (allBytesTheSame) {
+        memset(m_data, defPixel[0], tileSize);
+        return;
+    }
+
+    memcpy(m_data, defPixel, pixelSize);
+
+    qint64 filledSize = pixelSize;
+    while (filledSize < tileSize) {
+        const qint64 chunkSize = qMin(filledSize, tileSize - filledSize);
+        memcpy(m_data + filledSize, m_data, chunkSize);
+        filledSize += chunkSize;
     }
 }
 
@@ -132,6 +227,36 @@ void KisTileData::allocateMemory()
     m_data = allocateData(m_pixelSize);
 }
 
+inline int KisTileData::poolClass(qint32 pixelSize)
+{
+    switch (pixelSize) {
+    case 4:
+        return 0;
+    case 8:
+        return 1;
+    case 16:
+        return 2;
+    default:
+        return -1;
+    }
+}
+
+void KisTileData::notifyPooledAllocation(qint32 pixelSize)
+{
+    const int index = poolClass(pixelSize);
+    if (index < 0) return;
+
+    const int liveAllocations =
+        m_numLivePooledAllocations[index].fetchAndAddRelaxed(1) + 1;
+
+    int peak = m_peakPooledAllocations[index].loadAcquire();
+    while (liveAllocations > peak &&
+           !m_peakPooledAllocations[index].testAndSetOrdered(peak, liveAllocations)) {
+
+        peak = m_peakPooledAllocations[index].loadAcquire();
+    }
+}
+
 quint8* KisTileData::allocateData(const qint32 pixelSize)
 {
     quint8 *ptr = 0;
@@ -144,17 +269,27 @@ quint8* KisTileData::allocateData(const qint32 pixelSize)
         case 8:
             ptr = (quint8*)BoostPool8BPP::malloc();
             break;
+        case 16:
+            ptr = (quint8*)BoostPool16BPP::malloc();
+            break;
         default:
             ptr = (quint8*) malloc(pixelSize * WIDTH * HEIGHT);
             break;
         }
     }
 
+    notifyPooledAllocation(pixelSize);
+
     return ptr;
 }
 
 void KisTileData::freeData(quint8* ptr, const qint32 pixelSize)
 {
+    const int index = poolClass(pixelSize);
+    if (index >= 0) {
+        m_numLivePooledAllocations[index].fetchAndAddRelaxed(-1);
+    }
+
     if (!m_cache.push(pixelSize, ptr)) {
         switch (pixelSize) {
         case 4:
@@ -163,6 +298,9 @@ void KisTileData::freeData(quint8* ptr, const qint32 pixelSize)
         case 8:
             BoostPool8BPP::free(ptr);
             break;
+        case 16:
+            BoostPool16BPP::free(ptr);
+            break;
         default:
             free(ptr);
             break;
@@ -170,6 +308,29 @@ void KisTileData::freeData(quint8* ptr, const qint32 pixelSize)
     }
 }
 
+void KisTileData::debugPrintAllocatorStats()
+{
+    static const char *poolNames[NUM_POOL_CLASSES] = {"4BPP", "8BPP", "16BPP"};
+    static const int poolPixelSizes[NUM_POOL_CLASSES] = {4, 8, 16};
+
+    for (int i = 0; i < NUM_POOL_CLASSES; i++) {
+        const qint64 live = m_numLivePooledAllocations[i].loadAcquire();
+        const qint64 peak = m_peakPooledAllocations[i].loadAcquire();
+        const qint64 tileSize =
+            qint64(poolPixelSizes[i]) * WIDTH * HEIGHT;
+
+        /**
+         * The slabs of the pool never shrink below the peak until
+         * releaseInternalPools() is called, so (peak - live) is the
+         * upper bound of the memory held hostage by fragmentation.
+         */
+        dbgTiles << "Pool" << poolNames[i]
+                 << "	live:" << live << "(" << live * tileSize / MiB << "MiB )"
+                 << "	peak:" << peak << "(" << peak * tileSize / MiB << "MiB )"
+                 << "	fragmentation bound:" << (peak - live) * tileSize / MiB << "MiB";
+    }
+}
+
 //#define DEBUG_POOL_RELEASE
 
 #ifdef DEBUG_POOL_RELEASE
@@ -199,7 +360,8 @@ void KisTileData::releaseInternalPools()
 
             // check if the tile data has actually been pooled
             if (item->m_pixelSize != 4 &&
-                item->m_pixelSize != 8) {
+                item->m_pixelSize != 8 &&
+                item->m_pixelSize != 16) {
 
                 continue;
             }
@@ -224,6 +386,12 @@ void KisTileData::releaseInternalPools()
             m_cache.clear();
             BoostPool4BPP::purge_memory();
             BoostPool8BPP::purge_memory();
+            BoostPool16BPP::purge_memory();
+
+            for (int i = 0; i < NUM_POOL_CLASSES; i++) {
+                m_peakPooledAllocations[i].storeRelease(
+                    m_numLivePooledAllocations[i].loadAcquire());
+            }
 
             auto it = dataObjects.begin();
             auto chunkIt = memoryChunks.constBegin();
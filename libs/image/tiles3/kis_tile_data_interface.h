@@ -37,18 +37,26 @@ public:
     SimpleCache() = default;
     ~SimpleCache();
 
+    /**
+     * The maximum number of per-NUMA-node partitions of the cache.
+     * Nodes with a higher id share the last partition.
+     */
+    static const int MAX_NUMA_POOLS = 8;
+
     bool push(int pixelSize, quint8 *&ptr)
     {
         QReadLocker l(&m_cacheLock);
+        const int pool = poolIndex();
+
         switch (pixelSize) {
         case 4:
-            m_4Pool.push(ptr);
+            m_4Pool[pool].push(ptr);
             break;
         case 8:
-            m_8Pool.push(ptr);
+            m_8Pool[pool].push(ptr);
             break;
         case 16:
-            m_16Pool.push(ptr);
+            m_16Pool[pool].push(ptr);
             break;
         default:
             return false;
@@ -62,11 +70,11 @@ public:
         QReadLocker l(&m_cacheLock);
         switch (pixelSize) {
         case 4:
-            return m_4Pool.pop(ptr);
+            return popFrom(m_4Pool, ptr);
         case 8:
-            return m_8Pool.pop(ptr);
+            return popFrom(m_8Pool, ptr);
         case 16:
-            return m_16Pool.pop(ptr);
+            return popFrom(m_16Pool, ptr);
         default:
             return false;
         }
@@ -74,11 +82,46 @@ public:
 
     void clear();
 
+    /**
+     * Detect the NUMA topology of the host and split the cache into
+     * per-node free lists, so that the tile data handed out to a
+     * worker thread is (most probably) local to the node the thread
+     * is running on. Before the call (and when NUMA-aware pooling is
+     * disabled in the config) the cache behaves exactly like a single
+     * global pool.
+     */
+    static void initNumaTopology();
+
 private:
+    static int poolIndex();
+
+    bool popFrom(KisLocklessStack<quint8*> *pools, quint8 *&ptr)
+    {
+        const int local = poolIndex();
+        if (pools[local].pop(ptr)) {
+            return true;
+        }
+
+        /**
+         * Worker threads are not pinned, so memory may be pushed from
+         * a node the thread has already migrated away from. Steal
+         * from the remote partitions instead of letting that memory
+         * get stranded there.
+         */
+        for (int i = 0; i < m_numPools; i++) {
+            if (i != local && pools[i].pop(ptr)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     QReadWriteLock m_cacheLock;
-    KisLocklessStack<quint8*> m_4Pool;
-    KisLocklessStack<quint8*> m_8Pool;
-    KisLocklessStack<quint8*> m_16Pool;
+    static int m_numPools;
+    KisLocklessStack<quint8*> m_4Pool[MAX_NUMA_POOLS];
+    KisLocklessStack<quint8*> m_8Pool[MAX_NUMA_POOLS];
+    KisLocklessStack<quint8*> m_16Pool[MAX_NUMA_POOLS];
 };
 
 
@@ -307,7 +350,21 @@ private:
     KisTileDataStore *m_store;
     static SimpleCache m_cache;
 
+    /**
+     * Per-pool-class allocation statistics (4/8/16 BPP). The peak
+     * counter bounds the slab memory the pools may hold on to, so
+     * (peak - live) is the upper bound of the fragmentation cost.
+     */
+    static const int NUM_POOL_CLASSES = 3;
+    static QAtomicInt m_numLivePooledAllocations[NUM_POOL_CLASSES];
+    static QAtomicInt m_peakPooledAllocations[NUM_POOL_CLASSES];
+
+    static inline int poolClass(qint32 pixelSize);
+    static void notifyPooledAllocation(qint32 pixelSize);
+
 public:
+    static void debugPrintAllocatorStats();
+
     static const qint32 WIDTH;
     static const qint32 HEIGHT;
 };
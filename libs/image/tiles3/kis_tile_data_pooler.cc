@@ -82,6 +82,7 @@ KisTileDataPooler::KisTileDataPooler(KisTileDataStore *store, qint32 memoryLimit
     m_lastPoolMemoryMetric = 0;
     m_lastRealMemoryMetric = 0;
     m_lastHistoricalMemoryMetric = 0;
+    m_lastSharedMemoryMetric = 0;
 
     if(memoryLimit >= 0) {
         m_memoryLimit = memoryLimit;
@@ -187,12 +188,14 @@ void KisTileDataPooler::run()
 
         qint32 statRealMemory;
         qint32 statHistoricalMemory;
+        qint32 statSharedMemory;
 
 
         getLists(iter, beggers, donors,
                  memoryOccupied,
                  statRealMemory,
-                 statHistoricalMemory);
+                 statHistoricalMemory,
+                 statSharedMemory);
 
         m_lastCycleHadWork =
             processLists(beggers, donors, memoryOccupied);
@@ -200,6 +203,7 @@ void KisTileDataPooler::run()
         m_lastPoolMemoryMetric = memoryOccupied;
         m_lastRealMemoryMetric = statRealMemory;
         m_lastHistoricalMemoryMetric = statHistoricalMemory;
+        m_lastSharedMemoryMetric = statSharedMemory;
 
         m_store->endIteration(iter);
 
@@ -219,16 +223,19 @@ void KisTileDataPooler::forceUpdateMemoryStats()
 
     qint32 statRealMemory;
     qint32 statHistoricalMemory;
+    qint32 statSharedMemory;
 
 
     getLists(iter, beggers, donors,
              memoryOccupied,
              statRealMemory,
-             statHistoricalMemory);
+             statHistoricalMemory,
+             statSharedMemory);
 
     m_lastPoolMemoryMetric = memoryOccupied;
     m_lastRealMemoryMetric = statRealMemory;
     m_lastHistoricalMemoryMetric = statHistoricalMemory;
+    m_lastSharedMemoryMetric = statSharedMemory;
 
     m_store->endIteration(iter);
 }
@@ -248,6 +255,11 @@ qint64 KisTileDataPooler::lastHistoricalMemoryMetric() const
     return m_lastHistoricalMemoryMetric;
 }
 
+qint64 KisTileDataPooler::lastSharedMemoryMetric() const
+{
+    return m_lastSharedMemoryMetric;
+}
+
 inline int KisTileDataPooler::clonesMetric(KisTileData *td, int numClones) {
     return numClones * td->pixelSize();
 }
@@ -282,11 +294,13 @@ void KisTileDataPooler::getLists(Iter *iter,
                                  QList<KisTileData*> &donors,
                                  qint32 &memoryOccupied,
                                  qint32 &statRealMemory,
-                                 qint32 &statHistoricalMemory)
+                                 qint32 &statHistoricalMemory,
+                                 qint32 &statSharedMemory)
 {
     memoryOccupied = 0;
     statRealMemory = 0;
     statHistoricalMemory = 0;
+    statSharedMemory = 0;
 
     qint32 needMemoryTotal = 0;
     qint32 canDonorMemoryTotal = 0;
@@ -318,6 +332,15 @@ void KisTileDataPooler::getLists(Iter *iter,
         } else {
             statRealMemory += item->pixelSize();
         }
+
+        /**
+         * The memory saved by the tiles cloned lazily (COW):
+         * each user above the first one would need its own copy
+         * if the data were not shared.
+         */
+        if (item->numUsers() > 1) {
+            statSharedMemory += (item->numUsers() - 1) * item->pixelSize();
+        }
     }
 
     DEBUG_LISTS(memoryOccupied,
@@ -33,6 +33,7 @@ public:
     qint64 lastPoolMemoryMetric() const;
     qint64 lastRealMemoryMetric() const;
     qint64 lastHistoricalMemoryMetric() const;
+    qint64 lastSharedMemoryMetric() const;
 
 
     /**
@@ -65,7 +66,8 @@ protected:
                       QList<KisTileData*> &donors,
                       qint32 &memoryOccupied,
                       qint32 &statRealMemory,
-                      qint32 &statHistoricalMemory);
+                      qint32 &statHistoricalMemory,
+                      qint32 &statSharedMemory);
 
     bool processLists(QList<KisTileData*> &beggers,
                       QList<KisTileData*> &donors,
@@ -83,6 +85,7 @@ protected:
     qint32 m_lastPoolMemoryMetric;
     qint32 m_lastRealMemoryMetric;
     qint32 m_lastHistoricalMemoryMetric;
+    qint32 m_lastSharedMemoryMetric;
 };
 
 
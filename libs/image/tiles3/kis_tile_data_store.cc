@@ -63,6 +63,13 @@ KisTileDataStore::KisTileDataStore()
       m_counter(1),
       m_clockIndex(1)
 {
+    /**
+     * Must happen before the pooler starts cloning tile data:
+     * the pooler's clones should land on per-node free lists
+     * right from the start.
+     */
+    SimpleCache::initNumaTopology();
+
     m_pooler.start();
     m_swapper.start();
 }
@@ -101,6 +108,7 @@ KisTileDataStore::MemoryStatistics KisTileDataStore::memoryStatistics()
     stats.realMemorySize = m_pooler.lastRealMemoryMetric() * metricCoeff;
     stats.historicalMemorySize = m_pooler.lastHistoricalMemoryMetric() * metricCoeff;
     stats.poolSize = m_pooler.lastPoolMemoryMetric() * metricCoeff;
+    stats.sharedMemorySize = m_pooler.lastSharedMemoryMetric() * metricCoeff;
 
     stats.totalMemorySize = memoryMetric() * metricCoeff + stats.poolSize;
 
@@ -250,10 +258,42 @@ void KisTileDataStore::ensureTileDataLoaded(KisTileData *td)
          * <-- In theory, livelock is possible here...
          */
 
+        /**
+         * We have just hit the swap, so the neighbours of this tile
+         * in the swap-out log are likely to be hit soon as
+         * well. Wake the swapper to load them in the background.
+         */
+        m_swapper.requestPrefetch();
+
         td->m_swapLock.lockForRead();
     }
 }
 
+void KisTileDataStore::prefetchSwappedTiles()
+{
+    static const qint32 maxPrefetchTiles = 16;
+
+    /**
+     * Holding the iterator lock for write guarantees that no tile
+     * data object can be deleted (deletion takes it for read), so
+     * the pointers returned by the swapped store stay valid for the
+     * whole pass.
+     */
+    QWriteLocker locker(&m_iteratorLock);
+
+    Q_FOREACH (KisTileData *td, m_swappedStore.prefetchCandidates(maxPrefetchTiles)) {
+        if (td->data()) continue;
+        if (!td->m_swapLock.tryLockForWrite()) continue;
+
+        if (!td->data()) {
+            m_swappedStore.swapInTileData(td);
+            registerTileDataImp(td);
+        }
+
+        td->m_swapLock.unlock();
+    }
+}
+
 bool KisTileDataStore::trySwapTileData(KisTileData *td)
 {
     /**
@@ -312,6 +352,8 @@ void KisTileDataStore::endIteration(KisTileDataStoreClockIterator* iterator)
 
 void KisTileDataStore::debugPrintList()
 {
+    KisTileData::debugPrintAllocatorStats();
+
     KisTileDataStoreIterator* iter = beginIteration();
     KisTileData *item = 0;
 
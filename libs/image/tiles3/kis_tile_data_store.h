@@ -41,6 +41,12 @@ public:
 
         qint64 poolSize;
 
+        /**
+         * The amount of memory saved by the tiles shared between
+         * the clones of the devices (copy-on-write)
+         */
+        qint64 sharedMemorySize;
+
         qint64 swapSize;
     };
 
@@ -128,6 +134,13 @@ public:
      */
     void ensureTileDataLoaded(KisTileData *td);
 
+    /**
+     * Swap in the tiles the access-pattern predictor of the swapped
+     * store expects to be faulted next. Called by the swapper thread
+     * after a swap-in fault, when there is enough free memory.
+     */
+    void prefetchSwappedTiles();
+
     void registerTileData(KisTileData *td);
     void unregisterTileData(KisTileData *td);
 
@@ -70,6 +70,28 @@ public:
      *                     and it is not a lazily created default wrapper tile
      */
     TileTypeSP getReadOnlyTileLazy(qint32 col, qint32 row, bool &existingTile);
+
+    /**
+     * Fetches a whole row of tiles, [\p firstCol, \p lastCol], in one
+     * call. For the locked implementation this is just a convenience
+     * loop; the lock-free implementation uses it to amortize the
+     * per-tile guard costs. \see KisTileHashTableTraits2
+     */
+    void getTileRowLazy(qint32 firstCol, qint32 lastCol, qint32 row,
+                        TileTypeSP *tiles, bool writable, bool *newTiles)
+    {
+        for (qint32 i = 0; i <= lastCol - firstCol; i++) {
+            newTiles[i] = false;
+
+            if (writable) {
+                tiles[i] = getTileLazy(firstCol + i, row, newTiles[i]);
+            } else {
+                bool unused = false;
+                tiles[i] = getReadOnlyTileLazy(firstCol + i, row, unused);
+            }
+        }
+    }
+
     void addTile(TileTypeSP tile);
     bool deleteTile(TileTypeSP tile);
     bool deleteTile(qint32 col, qint32 row);
@@ -82,6 +82,21 @@ public:
      *                     and it is not a lazily created default wrapper tile
      */
     TileTypeSP getReadOnlyTileLazy(qint32 col, qint32 row, bool &existingTile);
+
+    /**
+     * Fetches a whole row of tiles, [\p firstCol, \p lastCol], in a
+     * single guarded traversal of the table, instead of paying the
+     * raw-pointer-lock/GC-update cost per tile. Tiles missing from
+     * the table are handled exactly like in getTileLazy() (when \p
+     * writable) or getReadOnlyTileLazy() (when not).
+     *
+     * \param tiles the output array of (lastCol - firstCol + 1) elements
+     * \param newTiles the output array telling which of the returned
+     *                 tiles were created during the call; only ever
+     *                 set for writable fetches
+     */
+    void getTileRowLazy(qint32 firstCol, qint32 lastCol, qint32 row,
+                        TileTypeSP *tiles, bool writable, bool *newTiles);
     void addTile(TileTypeSP tile);
     bool deleteTile(TileTypeSP tile);
     bool deleteTile(qint32 col, qint32 row);
@@ -389,6 +404,41 @@ typename KisTileHashTableTraits2<T>::TileTypeSP KisTileHashTableTraits2<T>::getR
     return tile;
 }
 
+template <class T>
+void KisTileHashTableTraits2<T>::getTileRowLazy(qint32 firstCol, qint32 lastCol, qint32 row,
+                                                TileTypeSP *tiles, bool writable, bool *newTiles)
+{
+    const qint32 numTiles = lastCol - firstCol + 1;
+
+    /**
+     * The fast path: all the existing tiles of the row are fetched
+     * under one raw-pointer lock and one GC tick.
+     */
+    m_map.getGC().lockRawPointerAccess();
+    for (qint32 i = 0; i < numTiles; i++) {
+        tiles[i] = m_map.get(calculateHash(firstCol + i, row));
+        newTiles[i] = false;
+    }
+    m_map.getGC().unlockRawPointerAccess();
+
+    for (qint32 i = 0; i < numTiles; i++) {
+        if (tiles[i]) continue;
+
+        if (writable) {
+            tiles[i] = getTileLazy(firstCol + i, row, newTiles[i]);
+        } else {
+            /**
+             * The same semantics as in getReadOnlyTileLazy(): a
+             * detached tile looking into the default tile data
+             */
+            QReadLocker locker(&m_defaultPixelDataLock);
+            tiles[i] = new TileType(firstCol + i, row, m_defaultTileData, 0);
+        }
+    }
+
+    m_map.getGC().update();
+}
+
 template <class T>
 void KisTileHashTableTraits2<T>::addTile(TileTypeSP tile)
 {
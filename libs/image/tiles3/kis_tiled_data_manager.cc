@@ -11,6 +11,8 @@
 
 #include "kis_tile.h"
 #include "kis_tiled_data_manager.h"
+
+#include <QtConcurrent>
 #include "kis_tile_data_wrapper.h"
 #include "kis_tiled_data_manager_p.h"
 #include "kis_memento_manager.h"
@@ -116,18 +118,70 @@ bool KisTiledDataManager::write(KisPaintDeviceWriter &store)
     KisTileHashTableConstIterator iter(m_hashTable);
     KisTileSP tile;
 
-    KisAbstractTileCompressorSP compressor =
-        KisTileCompressorFactory::create(CURRENT_VERSION);
+    /**
+     * The tiles are compressed in parallel into per-tile buffers and
+     * written to the store strictly in iteration order, so the file
+     * layout is identical to the serial writer. The batching bounds
+     * the buffered memory to a few megabytes regardless of the image
+     * size.
+     */
+    struct BufferWriter : public KisPaintDeviceWriter {
+        bool write(const QByteArray &data) override {
+            buffer.append(data);
+            return true;
+        }
+        bool write(const char *data, qint64 length) override {
+            buffer.append(data, length);
+            return true;
+        }
+        QByteArray buffer;
+    };
+
+    const auto compressTile = [] (KisTileSP tile) {
+        KisAbstractTileCompressorSP compressor =
+            KisTileCompressorFactory::create(CURRENT_VERSION);
+
+        BufferWriter writer;
+        if (!compressor->writeTile(tile, writer)) {
+            return QByteArray();
+        }
+
+        return writer.buffer;
+    };
+
+    static const int batchSize = 256;
+    QVector<KisTileSP> batch;
+    batch.reserve(batchSize);
+
+    const auto flushBatch = [&] () {
+        const QVector<QByteArray> blobs =
+            QtConcurrent::blockingMapped(batch, compressTile);
+
+        Q_FOREACH (const QByteArray &blob, blobs) {
+            if (blob.isEmpty() || !store.write(blob)) {
+                warnFile << "Failed to write tile";
+                return false;
+            }
+        }
+
+        batch.clear();
+        return true;
+    };
 
     while ((tile = iter.tile())) {
-        retval = compressor->writeTile(tile, store);
-        if (!retval) {
-            warnFile << "Failed to write tile";
+        batch.append(tile);
+
+        if (batch.size() >= batchSize && !(retval = flushBatch())) {
             break;
         }
+
         iter.next();
     }
 
+    if (retval && !batch.isEmpty()) {
+        retval = flushBatch();
+    }
+
     return retval;
 }
 bool KisTiledDataManager::read(QIODevice *stream)
@@ -9,6 +9,7 @@
 
 #include <QtGlobal>
 #include <QVector>
+#include <QVarLengthArray>
 #include <KisRegion.h>
 
 #include <kis_shared.h>
@@ -102,6 +103,34 @@ public:
         }
     }
 
+    /**
+     * A bulk version of getTilesPair(): pins the whole tile row
+     * [\p firstCol, \p lastCol] with a single traversal of the hash
+     * table, so the iterators don't pay the per-tile lookup overhead
+     * for every 64-pixel column. \p tiles and \p oldTiles must hold
+     * (lastCol - firstCol + 1) elements.
+     */
+    inline void getTilesRowPair(qint32 firstCol, qint32 lastCol, qint32 row, bool writable,
+                                KisTileSP *tiles, KisTileSP *oldTiles) {
+        const qint32 numTiles = lastCol - firstCol + 1;
+
+        QVarLengthArray<bool, 64> newTiles(numTiles);
+        m_hashTable->getTileRowLazy(firstCol, lastCol, row, tiles, writable, newTiles.data());
+
+        for (qint32 i = 0; i < numTiles; i++) {
+            if (newTiles[i]) {
+                m_extentManager.notifyTileAdded(firstCol + i, row);
+            }
+
+            bool unused;
+            oldTiles[i] = m_mementoManager->getCommitedTile(firstCol + i, row, unused);
+
+            if (!oldTiles[i]) {
+                oldTiles[i] = tiles[i];
+            }
+        }
+    }
+
     inline KisTileSP getTile(qint32 col, qint32 row, bool writable) {
         if (writable) {
             bool newTile;
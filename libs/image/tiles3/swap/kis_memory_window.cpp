@@ -9,8 +9,24 @@
 
 #include <QDir>
 
+#ifdef Q_OS_LINUX
+#include <sys/mman.h>
+#endif
+
 #define SWP_PREFIX "KRITA_SWAP_FILE_XXXXXX"
 
+#if defined(Q_OS_LINUX) && defined(MADV_HUGEPAGE)
+/**
+ * When the windows are aligned to the huge page size, the kernel can
+ * back them with transparent huge pages, which cuts the number of TLB
+ * misses while compressing/decompressing the swapped tiles. The
+ * advice is exactly that -- an advice -- so nothing breaks when the
+ * kernel has THP disabled.
+ */
+#define USE_TRANSPARENT_HUGE_PAGES
+static const quint64 hugePageSize = 2 * MiB;
+#endif
+
 KisMemoryWindow::KisMemoryWindow(const QString &swapDir, quint64 writeWindowSize)
     : m_readWindowEx(writeWindowSize / 4),
       m_writeWindowEx(writeWindowSize)
@@ -85,7 +101,19 @@ bool KisMemoryWindow::adjustWindow(const KisChunkData &requestedChunk,
             windowSize = requestedChunk.size();
         }
 
-        adjustingWindow->chunk.setChunk(requestedChunk.m_begin, windowSize);
+        quint64 windowBegin = requestedChunk.m_begin;
+
+#ifdef USE_TRANSPARENT_HUGE_PAGES
+        /**
+         * Align the window to the huge page boundary, growing it by
+         * the alignment delta, so that the request still fits.
+         */
+        const quint64 alignmentDelta = windowBegin & (hugePageSize - 1);
+        windowBegin -= alignmentDelta;
+        windowSize = (windowSize + alignmentDelta + hugePageSize - 1) & ~(hugePageSize - 1);
+#endif
+
+        adjustingWindow->chunk.setChunk(windowBegin, windowSize);
 
         if(adjustingWindow->chunk.m_end >= (quint64)m_file.size()) {
             // Align by 32 bytes
@@ -132,6 +160,12 @@ bool KisMemoryWindow::adjustWindow(const KisChunkData &requestedChunk,
         if (!adjustingWindow->window) {
             return false;
         }
+
+#ifdef USE_TRANSPARENT_HUGE_PAGES
+        madvise(adjustingWindow->window,
+                adjustingWindow->chunk.size(),
+                MADV_HUGEPAGE);
+#endif
     }
 
 	return true;
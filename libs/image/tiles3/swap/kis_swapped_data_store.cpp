@@ -25,7 +25,9 @@ KisSwappedDataStore::KisSwappedDataStore()
     m_swapSpace = new KisMemoryWindow(config.swapDir(), swapWindowSize);
 
     // FIXME: use a factory after the patch is committed
-    m_compressor = new KisTileCompressor2();
+    // the swap file is private to the process, so the adaptive
+    // LZF/zstd codec is safe here
+    m_compressor = new KisTileCompressor2(true);
 }
 
 KisSwappedDataStore::~KisSwappedDataStore()
@@ -74,6 +76,13 @@ bool KisSwappedDataStore::trySwapOutTileData(KisTileData *td)
 
     m_memoryMetric += td->pixelSize();
 
+    static const int maxSwapOutLogSize = 1024;
+
+    m_swapOutLog.append(td);
+    while (m_swapOutLog.size() > maxSwapOutLogSize) {
+        m_swapOutLog.removeFirst();
+    }
+
     return true;
 }
 
@@ -95,6 +104,12 @@ void KisSwappedDataStore::swapInTileData(KisTileData *td)
     m_allocator->freeChunk(chunk);
 
     m_memoryMetric -= td->pixelSize();
+
+    const int logIndex = m_swapOutLog.indexOf(td);
+    if (logIndex >= 0) {
+        m_swapOutLog.removeAt(logIndex);
+        m_lastSwapInPos = logIndex;
+    }
 }
 
 void KisSwappedDataStore::forgetTileData(KisTileData *td)
@@ -105,6 +120,29 @@ void KisSwappedDataStore::forgetTileData(KisTileData *td)
     td->setSwapChunk(KisChunk());
 
     m_memoryMetric -= td->pixelSize();
+
+    m_swapOutLog.removeOne(td);
+}
+
+QVector<KisTileData*> KisSwappedDataStore::prefetchCandidates(qint32 maxCount)
+{
+    QMutexLocker locker(&m_lock);
+    QVector<KisTileData*> candidates;
+
+    /**
+     * After swapInTileData() the entry at m_lastSwapInPos is the
+     * tile that was swapped out right after the faulted one, so the
+     * log positions [pos, pos + maxCount) are the natural guess for
+     * the next faults.
+     */
+    const int start = qBound(0, m_lastSwapInPos, m_swapOutLog.size());
+    const int end = qMin(start + maxCount, m_swapOutLog.size());
+
+    for (int i = start; i < end; i++) {
+        candidates.append(m_swapOutLog.at(i));
+    }
+
+    return candidates;
 }
 
 qint64 KisSwappedDataStore::totalMemoryMetric() const
@@ -11,6 +11,8 @@
 
 #include <QMutex>
 #include <QByteArray>
+#include <QList>
+#include <QVector>
 
 
 class QMutex;
@@ -53,6 +55,18 @@ public:
      */
     void forgetTileData(KisTileData *td);
 
+    /**
+     * Returns the tile data objects that were swapped out right
+     * after the one most recently swapped in, that is the tiles the
+     * access-pattern predictor expects to be faulted in next. The
+     * returned objects are *not* removed from the log.
+     *
+     * LOCKING: the returned pointers stay valid only as long as the
+     *          caller prevents concurrent deletion of tile data,
+     *          i.e. holds the store's iterator lock.
+     */
+    QVector<KisTileData*> prefetchCandidates(qint32 maxCount);
+
     /**
      * Retorns the metric of the total memory stored in the swap
      * in *uncompressed* form!
@@ -74,6 +88,15 @@ private:
     QMutex m_lock;
 
     qint64 m_memoryMetric;
+
+    /**
+     * The tile data objects in the order they were swapped out.
+     * Tiles that get swapped out together usually belong to one
+     * stroke or pan, so the position in this log is what the
+     * prefetcher uses to predict the next swap-in.
+     */
+    QList<KisTileData*> m_swapOutLog;
+    int m_lastSwapInPos {0};
 };
 
 #endif /* __KIS_SWAPPED_DATA_STORE_H */
@@ -7,20 +7,64 @@
 #include "kis_tile_compressor_2.h"
 #include "kis_lzf_compression.h"
 #include <QIODevice>
+#include <cmath>
 #include "kis_paint_device_writer.h"
+#include "kis_debug.h"
+
+#include <config-zstd.h>
+#ifdef HAVE_ZSTD
+#include "kis_zstd_compression.h"
+#endif
+
 #define TILE_DATA_SIZE(pixelSize) ((pixelSize) * KisTileData::WIDTH * KisTileData::HEIGHT)
 
 const QString KisTileCompressor2::m_compressionName = "LZF";
 
+/**
+ * A cheap estimate of the entropy of the tile data in bits per byte,
+ * computed on a sparse sample of the buffer. Flat and gradient-like
+ * tiles score low, photographic and noisy tiles score high.
+ */
+static qreal estimateTileEntropy(const quint8 *buffer, qint32 size)
+{
+    static const qint32 sampleStride = 16;
+
+    qint32 histogram[256] = {};
+    qint32 numSamples = 0;
+
+    for (qint32 i = 0; i < size; i += sampleStride, numSamples++) {
+        histogram[buffer[i]]++;
+    }
+
+    qreal entropy = 0.0;
+
+    for (qint32 i = 0; i < 256; i++) {
+        if (histogram[i] > 0) {
+            const qreal p = qreal(histogram[i]) / numSamples;
+            entropy -= p * std::log2(p);
+        }
+    }
+
+    return entropy;
+}
 
-KisTileCompressor2::KisTileCompressor2()
+KisTileCompressor2::KisTileCompressor2(bool useAdaptiveCodec)
 {
     m_compression = new KisLzfCompression();
+
+#ifdef HAVE_ZSTD
+    if (useAdaptiveCodec) {
+        m_zstdCompression = new KisZstdCompression();
+    }
+#else
+    Q_UNUSED(useAdaptiveCodec);
+#endif
 }
 
 KisTileCompressor2::~KisTileCompressor2()
 {
     delete m_compression;
+    delete m_zstdCompression;
 }
 
 bool KisTileCompressor2::writeTile(KisTileSP tile, KisPaintDeviceWriter &store)
@@ -91,7 +135,11 @@ void KisTileCompressor2::prepareStreamingBuffer(qint32 tileDataSize)
 
 void KisTileCompressor2::prepareWorkBuffers(qint32 tileDataSize)
 {
-    const qint32 bufferSize = m_compression->outputBufferSize(tileDataSize);
+    qint32 bufferSize = m_compression->outputBufferSize(tileDataSize);
+
+    if (m_zstdCompression) {
+        bufferSize = qMax(bufferSize, m_zstdCompression->outputBufferSize(tileDataSize));
+    }
 
     m_linearizationBuffer.resize(tileDataSize);
     m_compressionBuffer.resize(bufferSize);
@@ -114,11 +162,29 @@ void KisTileCompressor2::compressTileData(KisTileData *tileData,
     KisAbstractCompression::linearizeColors(tileData->data(), (quint8*)m_linearizationBuffer.data(),
                                             tileDataSize, pixelSize);
 
-    compressedBytes = m_compression->compress((quint8*)m_linearizationBuffer.data(), tileDataSize,
-                                              (quint8*)m_compressionBuffer.data(), m_compressionBuffer.size());
+    KisAbstractCompression *codec = m_compression;
+    qint8 compressedFlag = COMPRESSED_DATA_FLAG;
+
+    if (m_zstdCompression) {
+        /**
+         * Low-entropy tiles compress well enough with the much
+         * faster LZF; on the high-entropy ones zstd wins enough
+         * ratio to justify its extra cost.
+         */
+        static const qreal entropyThreshold = 5.0;
+
+        if (estimateTileEntropy((quint8*)m_linearizationBuffer.data(),
+                                tileDataSize) > entropyThreshold) {
+            codec = m_zstdCompression;
+            compressedFlag = ZSTD_COMPRESSED_DATA_FLAG;
+        }
+    }
+
+    compressedBytes = codec->compress((quint8*)m_linearizationBuffer.data(), tileDataSize,
+                                      (quint8*)m_compressionBuffer.data(), m_compressionBuffer.size());
 
-    if(compressedBytes < tileDataSize) {
-        buffer[0] = COMPRESSED_DATA_FLAG;
+    if(compressedBytes > 0 && compressedBytes < tileDataSize) {
+        buffer[0] = compressedFlag;
         memcpy(buffer + 1, m_compressionBuffer.data(), compressedBytes);
         bytesWritten = compressedBytes + 1;
     }
@@ -136,12 +202,29 @@ bool KisTileCompressor2::decompressTileData(quint8 *buffer,
     const qint32 pixelSize = tileData->pixelSize();
     const qint32 tileDataSize = TILE_DATA_SIZE(pixelSize);
 
-    if(buffer[0] == COMPRESSED_DATA_FLAG) {
+    if(buffer[0] == COMPRESSED_DATA_FLAG ||
+       buffer[0] == ZSTD_COMPRESSED_DATA_FLAG) {
+
+        KisAbstractCompression *codec = m_compression;
+
+        if (buffer[0] == ZSTD_COMPRESSED_DATA_FLAG) {
+#ifdef HAVE_ZSTD
+            if (!m_zstdCompression) {
+                m_zstdCompression = new KisZstdCompression();
+            }
+            codec = m_zstdCompression;
+#else
+            warnKrita << "Cannot decompress a zstd-compressed tile:"
+                      << "Krita was built without libzstd";
+            return false;
+#endif
+        }
+
         prepareWorkBuffers(tileDataSize);
 
         qint32 bytesWritten;
-        bytesWritten = m_compression->decompress(buffer + 1, bufferSize - 1,
-                                                 (quint8*)m_linearizationBuffer.data(), tileDataSize);
+        bytesWritten = codec->decompress(buffer + 1, bufferSize - 1,
+                                         (quint8*)m_linearizationBuffer.data(), tileDataSize);
         if (bytesWritten == tileDataSize) {
             KisAbstractCompression::delinearizeColors((quint8*)m_linearizationBuffer.data(),
                                                       tileData->data(),
@@ -14,7 +14,17 @@ class KisAbstractCompression;
 class KRITAIMAGE_EXPORT KisTileCompressor2 : public KisAbstractTileCompressor
 {
 public:
-    KisTileCompressor2();
+    /**
+     * When \p useAdaptiveCodec is true (and the build has libzstd),
+     * compressTileData() picks between LZF and zstd per-tile, based
+     * on the entropy of the tile data: low-entropy tiles compress
+     * well enough with the much faster LZF, while for high-entropy
+     * tiles zstd's better ratio pays for its cost. The choice is
+     * recorded in the per-tile flag byte, so the mode is safe for
+     * the swap file, but must stay off for the streams that end up
+     * in .kra files.
+     */
+    KisTileCompressor2(bool useAdaptiveCodec = false);
     ~KisTileCompressor2() override;
 
     bool writeTile(KisTileSP tile, KisPaintDeviceWriter &store) override;
@@ -40,12 +50,14 @@ private:
 private:
     static const qint8 RAW_DATA_FLAG = 0;
     static const qint8 COMPRESSED_DATA_FLAG = 1;
+    static const qint8 ZSTD_COMPRESSED_DATA_FLAG = 2;
 
 private:
     QByteArray m_linearizationBuffer;
     QByteArray m_compressionBuffer;
     QByteArray m_streamingBuffer;
     KisAbstractCompression *m_compression;
+    KisAbstractCompression *m_zstdCompression {0};
     static const QString m_compressionName;
 };
 
@@ -37,6 +37,7 @@ struct Q_DECL_HIDDEN KisTileDataSwapper::Private
 public:
     QSemaphore semaphore;
     QAtomicInt shouldExitFlag;
+    QAtomicInt prefetchRequested;
     KisTileDataStore *store;
     KisStoreLimits limits;
     QMutex cycleLock;
@@ -74,6 +75,12 @@ void KisTileDataSwapper::waitForWork()
     m_d->semaphore.tryAcquire(1, TIMEOUT);
 }
 
+void KisTileDataSwapper::requestPrefetch()
+{
+    m_d->prefetchRequested.storeRelease(1);
+    kick();
+}
+
 void KisTileDataSwapper::run()
 {
     while (1) {
@@ -82,6 +89,17 @@ void KisTileDataSwapper::run()
         if (m_d->shouldExitFlag)
             return;
 
+        if (m_d->prefetchRequested.fetchAndStoreOrdered(0)) {
+            /**
+             * Prefetching is pure opportunism: skip it when we are
+             * close to the limits, otherwise we would swap the
+             * loaded tiles right out again.
+             */
+            if (m_d->store->memoryMetric() < m_d->limits.softLimitThreshold()) {
+                m_d->store->prefetchSwappedTiles();
+            }
+        }
+
         QThread::msleep(DELAY);
 
         doJob();
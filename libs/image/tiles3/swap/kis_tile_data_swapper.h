@@ -28,6 +28,13 @@ public:
     void terminateSwapper();
     void checkFreeMemory();
 
+    /**
+     * Ask the swapper thread to prefetch the tiles predicted by the
+     * swapped store's access-pattern log. Cheap enough to be called
+     * from the swap-fault path.
+     */
+    void requestPrefetch();
+
     void testingRereadConfig();
 
 private:
@@ -0,0 +1,46 @@
+/*
+ *  SPDX-FileCopyrightText: 2026 Krita contributors
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include "kis_zstd_compression.h"
+
+#include <zstd.h>
+
+/**
+ * Tiles are compressed one-shot and stay hot for a short time only,
+ * so we use the fastest level: even at level 1 zstd beats LZF on
+ * ratio by a wide margin.
+ */
+#define ZSTD_TILE_COMPRESSION_LEVEL 1
+
+KisZstdCompression::KisZstdCompression()
+{
+}
+
+KisZstdCompression::~KisZstdCompression()
+{
+}
+
+qint32 KisZstdCompression::compress(const quint8* input, qint32 inputLength, quint8* output, qint32 outputLength)
+{
+    const size_t result = ZSTD_compress(output, outputLength,
+                                        input, inputLength,
+                                        ZSTD_TILE_COMPRESSION_LEVEL);
+
+    return !ZSTD_isError(result) ? qint32(result) : 0;
+}
+
+qint32 KisZstdCompression::decompress(const quint8* input, qint32 inputLength, quint8* output, qint32 outputLength)
+{
+    const size_t result = ZSTD_decompress(output, outputLength,
+                                          input, inputLength);
+
+    return !ZSTD_isError(result) ? qint32(result) : 0;
+}
+
+qint32 KisZstdCompression::outputBufferSize(qint32 dataSize)
+{
+    return qint32(ZSTD_compressBound(dataSize));
+}
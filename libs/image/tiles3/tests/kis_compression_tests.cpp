@@ -13,6 +13,11 @@
 #include "tiles3/swap/kis_lzf_compression.h"
 #include <kis_debug.h>
 
+#include <config-zstd.h>
+#ifdef HAVE_ZSTD
+#include "tiles3/swap/kis_zstd_compression.h"
+#endif
+
 #define TEST_FILE "tile.png"
 //#define TEST_FILE "hakonepa.png"
 
@@ -209,6 +214,53 @@ void KisCompressionTests::testLzfOverflow()
     delete compression;
 }
 
+void KisCompressionTests::testZstdRoundTrip()
+{
+#ifdef HAVE_ZSTD
+    KisAbstractCompression *compression = new KisZstdCompression();
+
+    roundTrip(compression);
+    roundTripTwoPass(compression);
+
+    delete compression;
+#else
+    QSKIP("Krita was built without libzstd");
+#endif
+}
+
+void KisCompressionTests::testZstdOverflow()
+{
+#ifdef HAVE_ZSTD
+    KisAbstractCompression *compression = new KisZstdCompression();
+    testOverflow(compression);
+    delete compression;
+#else
+    QSKIP("Krita was built without libzstd");
+#endif
+}
+
+void KisCompressionTests::benchmarkCompressionZstd()
+{
+#ifdef HAVE_ZSTD
+    KisAbstractCompression *compression = new KisZstdCompression();
+    benchmarkCompression(compression);
+    delete compression;
+#else
+    QSKIP("Krita was built without libzstd");
+#endif
+}
+
+void KisCompressionTests::benchmarkDecompressionZstd()
+{
+#ifdef HAVE_ZSTD
+    KisAbstractCompression *compression = new KisZstdCompression();
+    benchmarkDecompression(compression);
+    delete compression;
+#else
+    QSKIP("Krita was built without libzstd");
+#endif
+}
+
 void KisCompressionTests::benchmarkMemCpy()
 {
     QImage image(QString(FILES_DATA_DIR) + QDir::separator() + TEST_FILE);
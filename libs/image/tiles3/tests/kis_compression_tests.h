@@ -30,6 +30,11 @@ private Q_SLOTS:
     void testLzfRoundTrip();
     void testLzfOverflow();
 
+    void testZstdRoundTrip();
+    void testZstdOverflow();
+    void benchmarkCompressionZstd();
+    void benchmarkDecompressionZstd();
+
     void benchmarkMemCpy();
 
     void benchmarkCompressionLzf();
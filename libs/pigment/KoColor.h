@@ -260,6 +260,13 @@ private:
     }
 
     const KoColorSpace *m_colorSpace;
+
+    /**
+     * The pixel is stored inline: brush engines construct thousands
+     * of KoColor objects per stroke (color sampling in colorsmudge
+     * being the worst case), so this class must stay free of heap
+     * allocations and stay trivially copyable in layout.
+     */
     quint8 m_data[MAX_PIXEL_SIZE];
     quint8 m_size;
 };
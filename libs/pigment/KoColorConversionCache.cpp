@@ -64,8 +64,26 @@ struct KoColorConversionCache::CachedTransformation {
 typedef QPair<KoColorConversionCacheKey, KoCachedColorConversionTransformation> FastPathCacheItem;
 
 struct KoColorConversionCache::Private {
-    QMultiHash< KoColorConversionCacheKey, CachedTransformation*> cache;
-    QMutex cacheMutex;
+    /**
+     * The cache is sharded by the key hash, so that concurrent
+     * lookups of different conversions (e.g. the workers of a
+     * multithreaded filter converting tiles) do not serialize on a
+     * single mutex. Lookups of the *same* conversion from the same
+     * thread are served by the per-thread fast path below and do not
+     * touch the shards at all.
+     */
+    static const int NUM_SHARDS = 16;
+
+    struct Shard {
+        QMultiHash< KoColorConversionCacheKey, CachedTransformation*> cache;
+        QMutex cacheMutex;
+    };
+
+    Shard shards[NUM_SHARDS];
+
+    Shard& shardForKey(const KoColorConversionCacheKey &key) {
+        return shards[qHash(key) % NUM_SHARDS];
+    }
 
     QThreadStorage<FastPathCacheItem*> fastStorage;
 };
@@ -77,8 +95,10 @@ KoColorConversionCache::KoColorConversionCache() : d(new Private)
 
 KoColorConversionCache::~KoColorConversionCache()
 {
-    Q_FOREACH (CachedTransformation* transfo, d->cache) {
-        delete transfo;
+    for (int i = 0; i < Private::NUM_SHARDS; i++) {
+        Q_FOREACH (CachedTransformation* transfo, d->shards[i].cache) {
+            delete transfo;
+        }
     }
     delete d;
 }
@@ -101,8 +121,10 @@ KoCachedColorConversionTransformation KoColorConversionCache::cachedConverter(co
 
     cacheItem = 0;
 
-    QMutexLocker lock(&d->cacheMutex);
-    QList< CachedTransformation* > cachedTransfos = d->cache.values(key);
+    Private::Shard &shard = d->shardForKey(key);
+
+    QMutexLocker lock(&shard.cacheMutex);
+    QList< CachedTransformation* > cachedTransfos = shard.cache.values(key);
     if (cachedTransfos.size() != 0) {
         Q_FOREACH (CachedTransformation* ct, cachedTransfos) {
             if (ct->available()) {
@@ -117,7 +139,7 @@ KoCachedColorConversionTransformation KoColorConversionCache::cachedConverter(co
     if (!cacheItem) {
         KoColorConversionTransformation* transfo = src->createColorConverter(dst, _renderingIntent, _conversionFlags);
         CachedTransformation* ct = new CachedTransformation(transfo);
-        d->cache.insert(key, ct);
+        shard.cache.insert(key, ct);
         cacheItem = new FastPathCacheItem(key, KoCachedColorConversionTransformation(this, ct));
     }
 
@@ -129,15 +151,19 @@ void KoColorConversionCache::colorSpaceIsDestroyed(const KoColorSpace* cs)
 {
     d->fastStorage.setLocalData(0);
 
-    QMutexLocker lock(&d->cacheMutex);
-    QMultiHash< KoColorConversionCacheKey, CachedTransformation*>::iterator endIt = d->cache.end();
-    for (QMultiHash< KoColorConversionCacheKey, CachedTransformation*>::iterator it = d->cache.begin(); it != endIt;) {
-        if (it.key().src == cs || it.key().dst == cs) {
-            Q_ASSERT(it.value()->available()); // That's terribely evil, if that assert fails, that means that someone is using a color transformation with a color space which is currently being deleted
-            delete it.value();
-            it = d->cache.erase(it);
-        } else {
-            ++it;
+    for (int i = 0; i < Private::NUM_SHARDS; i++) {
+        Private::Shard &shard = d->shards[i];
+
+        QMutexLocker lock(&shard.cacheMutex);
+        QMultiHash< KoColorConversionCacheKey, CachedTransformation*>::iterator endIt = shard.cache.end();
+        for (QMultiHash< KoColorConversionCacheKey, CachedTransformation*>::iterator it = shard.cache.begin(); it != endIt;) {
+            if (it.key().src == cs || it.key().dst == cs) {
+                Q_ASSERT(it.value()->available()); // That's terribely evil, if that assert fails, that means that someone is using a color transformation with a color space which is currently being deleted
+                delete it.value();
+                it = shard.cache.erase(it);
+            } else {
+                ++it;
+            }
         }
     }
 }
@@ -0,0 +1,48 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Krita contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#include "KoColorConversionSession.h"
+
+#include <cstring>
+
+#include "KoColorSpace.h"
+#include "KoColorSpaceRegistry.h"
+#include "KoColorConversionCache.h"
+
+struct KoColorConversionSession::Private {
+    QScopedPointer<KoCachedColorConversionTransformation> cachedTransformation;
+    qint32 srcPixelSize = 0;
+};
+
+KoColorConversionSession::KoColorConversionSession(const KoColorSpace *srcColorSpace,
+                                                   const KoColorSpace *dstColorSpace,
+                                                   KoColorConversionTransformation::Intent renderingIntent,
+                                                   KoColorConversionTransformation::ConversionFlags conversionFlags)
+    : d(new Private)
+{
+    d->srcPixelSize = srcColorSpace->pixelSize();
+
+    if (*srcColorSpace != *dstColorSpace) {
+        d->cachedTransformation.reset(
+            new KoCachedColorConversionTransformation(
+                KoColorSpaceRegistry::instance()->colorConversionCache()->cachedConverter(
+                    srcColorSpace, dstColorSpace,
+                    renderingIntent, conversionFlags)));
+    }
+}
+
+KoColorConversionSession::~KoColorConversionSession()
+{
+}
+
+void KoColorConversionSession::convert(const quint8 *src, quint8 *dst, qint32 numPixels) const
+{
+    if (d->cachedTransformation) {
+        d->cachedTransformation->transformation()->transform(src, dst, numPixels);
+    } else if (src != dst) {
+        memcpy(dst, src, qint64(numPixels) * d->srcPixelSize);
+    }
+}
@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Krita contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+*/
+
+#ifndef _KO_COLOR_CONVERSION_SESSION_H_
+#define _KO_COLOR_CONVERSION_SESSION_H_
+
+#include <QtGlobal>
+#include <QScopedPointer>
+
+#include "KoColorConversionTransformation.h"
+#include "kritapigment_export.h"
+
+class KoColorSpace;
+
+/**
+ * A conversion session pins the cached color transformation for a
+ * (src, dst, intent, flags) tuple once and then converts any number
+ * of pixel spans without going back to KoColorConversionCache. Use it
+ * instead of repeated KoColorSpace::convertPixelsTo() calls whenever
+ * many spans of the same conversion are processed in a row (layer
+ * conversion, import/export), where the per-call cache lookup and its
+ * mutex become measurable.
+ *
+ * The session keeps the transformation marked as used for its whole
+ * lifetime, so it must not outlive the color spaces it was created
+ * with.
+ */
+class KRITAPIGMENT_EXPORT KoColorConversionSession
+{
+public:
+    KoColorConversionSession(const KoColorSpace *srcColorSpace,
+                             const KoColorSpace *dstColorSpace,
+                             KoColorConversionTransformation::Intent renderingIntent,
+                             KoColorConversionTransformation::ConversionFlags conversionFlags);
+    ~KoColorConversionSession();
+
+    /**
+     * Converts \p numPixels pixels. Unlike convertPixelsTo() this
+     * never touches the conversion cache, so it is safe to call
+     * concurrently from many threads with the same session only if
+     * the underlying transformation is stateless (which the lcms
+     * transformations are); create one session per thread otherwise.
+     */
+    void convert(const quint8 *src, quint8 *dst, qint32 numPixels) const;
+
+private:
+    Q_DISABLE_COPY(KoColorConversionSession)
+
+    struct Private;
+    const QScopedPointer<Private> d;
+};
+
+#endif
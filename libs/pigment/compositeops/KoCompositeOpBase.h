@@ -44,8 +44,20 @@ public:
 
     void composite(const KoCompositeOp::ParameterInfo& params) const override {
 
-        const QBitArray& flags           = params.channelFlags.isEmpty() ? QBitArray(channels_nb,true) : params.channelFlags;
-        bool             allChannelFlags = params.channelFlags.isEmpty() || params.channelFlags == QBitArray(channels_nb,true);
+        /**
+         * Allocated once per template instantiation: composite() is
+         * called for every patch of every dab, so the temporary
+         * QBitArray used to show up in the profiles of plain-U8
+         * strokes. The actual per-pixel math is already selected at
+         * instantiation time: for the integer channel types all the
+         * Arithmetic:: helpers resolve to the fixed-point
+         * specializations of KoColorSpaceMaths (UINT8_MULT and
+         * friends), so no float is touched inside the loops.
+         */
+        static const QBitArray fullChannelFlags(channels_nb, true);
+
+        const QBitArray& flags           = params.channelFlags.isEmpty() ? fullChannelFlags : params.channelFlags;
+        bool             allChannelFlags = params.channelFlags.isEmpty() || params.channelFlags == fullChannelFlags;
         bool             alphaLocked     = (alpha_pos != -1) && !flags.testBit(alpha_pos);
         bool             useMask         = params.maskRowStart != 0;
 
@@ -7,6 +7,9 @@
 #ifndef _KOCOMPOSITEOP_GENERIC_H_
 #define _KOCOMPOSITEOP_GENERIC_H_
 
+#include <type_traits>
+#include <vector>
+
 #include "KoCompositeOpFunctions.h"
 #include "KoCompositeOpBase.h"
 
@@ -33,37 +36,69 @@ public:
     KoCompositeOpGenericSC(const KoColorSpace* cs, const QString& id, const QString& description, const QString& category)
         : base_class(cs, id, description, category) { }
 
+private:
+    /**
+     * For U8 channels the whole 256x256 input space of the blend
+     * function fits into a 64K lookup table, so expensive modes
+     * (color dodge and friends with their per-channel divisions)
+     * degenerate into a table fetch. The table is built lazily on
+     * the first composite pass of the instantiated mode and shared
+     * by all its instances.
+     */
+    inline static channels_type compositeChannel(channels_type src, channels_type dst, std::true_type /*useLut*/) {
+        static const std::vector<quint8> lut = [] () {
+            std::vector<quint8> table(256 * 256);
+            for (int s = 0; s < 256; s++) {
+                for (int d = 0; d < 256; d++) {
+                    table[(s << 8) | d] = compositeFunc(channels_type(s), channels_type(d));
+                }
+            }
+            return table;
+        }();
+
+        return lut[(int(src) << 8) | int(dst)];
+    }
+
+    inline static channels_type compositeChannel(channels_type src, channels_type dst, std::false_type /*useLut*/) {
+        return compositeFunc(src, dst);
+    }
+
+    inline static channels_type compositeChannel(channels_type src, channels_type dst) {
+        return compositeChannel(src, dst,
+            std::integral_constant<bool, std::is_same<channels_type, quint8>::value>());
+    }
+
 public:
     template<bool alphaLocked, bool allChannelFlags>
     inline static channels_type composeColorChannels(const channels_type* src, channels_type srcAlpha,
                                                      channels_type*       dst, channels_type dstAlpha, channels_type maskAlpha,
                                                      channels_type opacity, const QBitArray& channelFlags) {
         using namespace Arithmetic;
-        
+
         srcAlpha = mul(srcAlpha, maskAlpha, opacity);
-        
+
         if(alphaLocked) {
             if(dstAlpha != zeroValue<channels_type>()) {
                 for(qint32 i=0; i <channels_nb; i++) {
                     if(i != alpha_pos && (allChannelFlags || channelFlags.testBit(i)))
-                        dst[i] = lerp(dst[i], compositeFunc(src[i],dst[i]), srcAlpha);
+                        dst[i] = lerp(dst[i], compositeChannel(src[i],dst[i]), srcAlpha);
                 }
             }
-            
+
             return dstAlpha;
         }
         else {
             channels_type newDstAlpha = unionShapeOpacity(srcAlpha, dstAlpha);
-            
+
             if(newDstAlpha != zeroValue<channels_type>()) {
                 for(qint32 i=0; i <channels_nb; i++) {
                     if(i != alpha_pos && (allChannelFlags || channelFlags.testBit(i))) {
-                        channels_type result = blend(src[i], srcAlpha, dst[i], dstAlpha, compositeFunc(src[i],dst[i]));
+                        channels_type result = blend(src[i], srcAlpha, dst[i], dstAlpha, compositeChannel(src[i],dst[i]));
                         dst[i] = div(result, newDstAlpha);
                     }
                 }
             }
-            
+
             return newDstAlpha;
         }
     }
@@ -49,6 +49,37 @@ struct OptimizedOpsSelector
     static KoCompositeOp* createOverOp(const KoColorSpace *cs) {
         return new KoCompositeOpOver<Traits>(cs);
     }
+    static KoCompositeOp* createMultiplyOp(const KoColorSpace *cs) {
+        return new KoCompositeOpGenericSC<Traits, &cfMultiply<typename Traits::channels_type> >(
+            cs, COMPOSITE_MULT, i18n("Multiply"), KoCompositeOp::categoryArithmetic());
+    }
+    static KoCompositeOp* createScreenOp(const KoColorSpace *cs) {
+        return new KoCompositeOpGenericSC<Traits, &cfScreen<typename Traits::channels_type> >(
+            cs, COMPOSITE_SCREEN, i18n("Screen"), KoCompositeOp::categoryLight());
+    }
+    static KoCompositeOp* createEraseOp(const KoColorSpace *cs) {
+        return new KoCompositeOpErase<Traits>(cs);
+    }
+    static KoCompositeOp* createColorDodgeOp(const KoColorSpace *cs) {
+        return new KoCompositeOpGenericSC<Traits, &cfColorDodge<typename Traits::channels_type> >(
+            cs, COMPOSITE_DODGE, i18n("Color Dodge"), KoCompositeOp::categoryLight());
+    }
+    static KoCompositeOp* createColorBurnOp(const KoColorSpace *cs) {
+        return new KoCompositeOpGenericSC<Traits, &cfColorBurn<typename Traits::channels_type> >(
+            cs, COMPOSITE_BURN, i18n("Color Burn"), KoCompositeOp::categoryDark());
+    }
+    static KoCompositeOp* createHardLightOp(const KoColorSpace *cs) {
+        return new KoCompositeOpGenericSC<Traits, &cfHardLight<typename Traits::channels_type> >(
+            cs, COMPOSITE_HARD_LIGHT, i18n("Hard Light"), KoCompositeOp::categoryLight());
+    }
+    static KoCompositeOp* createOverlayOp(const KoColorSpace *cs) {
+        return new KoCompositeOpGenericSC<Traits, &cfOverlay<typename Traits::channels_type> >(
+            cs, COMPOSITE_OVERLAY, i18n("Overlay"), KoCompositeOp::categoryMix());
+    }
+    static KoCompositeOp* createLinearDodgeOp(const KoColorSpace *cs) {
+        return new KoCompositeOpGenericSC<Traits, &cfAddition<typename Traits::channels_type> >(
+            cs, COMPOSITE_LINEAR_DODGE, i18n("Linear Dodge"), KoCompositeOp::categoryLight());
+    }
 };
 
 template<>
@@ -62,6 +93,30 @@ struct OptimizedOpsSelector<KoBgrU8Traits>
     static KoCompositeOp* createOverOp(const KoColorSpace *cs) {
         return KoOptimizedCompositeOpFactory::createOverOp32(cs);
     }
+    static KoCompositeOp* createMultiplyOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createMultiplyOp32(cs);
+    }
+    static KoCompositeOp* createScreenOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createScreenOp32(cs);
+    }
+    static KoCompositeOp* createEraseOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createEraseOp32(cs);
+    }
+    static KoCompositeOp* createColorDodgeOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createColorDodgeOp32(cs);
+    }
+    static KoCompositeOp* createColorBurnOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createColorBurnOp32(cs);
+    }
+    static KoCompositeOp* createHardLightOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createHardLightOp32(cs);
+    }
+    static KoCompositeOp* createOverlayOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createOverlayOp32(cs);
+    }
+    static KoCompositeOp* createLinearDodgeOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createLinearDodgeOp32(cs);
+    }
 };
 
 template<>
@@ -75,6 +130,30 @@ struct OptimizedOpsSelector<KoLabU8Traits>
     static KoCompositeOp* createOverOp(const KoColorSpace *cs) {
         return KoOptimizedCompositeOpFactory::createOverOp32(cs);
     }
+    static KoCompositeOp* createMultiplyOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createMultiplyOp32(cs);
+    }
+    static KoCompositeOp* createScreenOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createScreenOp32(cs);
+    }
+    static KoCompositeOp* createEraseOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createEraseOp32(cs);
+    }
+    static KoCompositeOp* createColorDodgeOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createColorDodgeOp32(cs);
+    }
+    static KoCompositeOp* createColorBurnOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createColorBurnOp32(cs);
+    }
+    static KoCompositeOp* createHardLightOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createHardLightOp32(cs);
+    }
+    static KoCompositeOp* createOverlayOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createOverlayOp32(cs);
+    }
+    static KoCompositeOp* createLinearDodgeOp(const KoColorSpace *cs) {
+        return KoOptimizedCompositeOpFactory::createLinearDodgeOp32(cs);
+    }
 };
 
 template<>
@@ -99,6 +178,37 @@ struct OptimizedOpsSelector<KoRgbF32Traits>
     static KoCompositeOp* createOverOp(const KoColorSpace *cs) {
         return KoOptimizedCompositeOpFactory::createOverOp128(cs);
     }
+    static KoCompositeOp* createMultiplyOp(const KoColorSpace *cs) {
+        return new KoCompositeOpGenericSC<KoRgbF32Traits, &cfMultiply<float> >(
+            cs, COMPOSITE_MULT, i18n("Multiply"), KoCompositeOp::categoryArithmetic());
+    }
+    static KoCompositeOp* createScreenOp(const KoColorSpace *cs) {
+        return new KoCompositeOpGenericSC<KoRgbF32Traits, &cfScreen<float> >(
+            cs, COMPOSITE_SCREEN, i18n("Screen"), KoCompositeOp::categoryLight());
+    }
+    static KoCompositeOp* createEraseOp(const KoColorSpace *cs) {
+        return new KoCompositeOpErase<KoRgbF32Traits>(cs);
+    }
+    static KoCompositeOp* createColorDodgeOp(const KoColorSpace *cs) {
+        return new KoCompositeOpGenericSC<KoRgbF32Traits, &cfColorDodge<float> >(
+            cs, COMPOSITE_DODGE, i18n("Color Dodge"), KoCompositeOp::categoryLight());
+    }
+    static KoCompositeOp* createColorBurnOp(const KoColorSpace *cs) {
+        return new KoCompositeOpGenericSC<KoRgbF32Traits, &cfColorBurn<float> >(
+            cs, COMPOSITE_BURN, i18n("Color Burn"), KoCompositeOp::categoryDark());
+    }
+    static KoCompositeOp* createHardLightOp(const KoColorSpace *cs) {
+        return new KoCompositeOpGenericSC<KoRgbF32Traits, &cfHardLight<float> >(
+            cs, COMPOSITE_HARD_LIGHT, i18n("Hard Light"), KoCompositeOp::categoryLight());
+    }
+    static KoCompositeOp* createOverlayOp(const KoColorSpace *cs) {
+        return new KoCompositeOpGenericSC<KoRgbF32Traits, &cfOverlay<float> >(
+            cs, COMPOSITE_OVERLAY, i18n("Overlay"), KoCompositeOp::categoryMix());
+    }
+    static KoCompositeOp* createLinearDodgeOp(const KoColorSpace *cs) {
+        return new KoCompositeOpGenericSC<KoRgbF32Traits, &cfAddition<float> >(
+            cs, COMPOSITE_LINEAR_DODGE, i18n("Linear Dodge"), KoCompositeOp::categoryLight());
+    }
 };
 
 template<class Traits>
@@ -117,13 +227,13 @@ struct AddGeneralOps<Traits, true>
          cs->addCompositeOp(OptimizedOpsSelector<Traits>::createOverOp(cs));
          cs->addCompositeOp(OptimizedOpsSelector<Traits>::createAlphaDarkenOp(cs));
          cs->addCompositeOp(new KoCompositeOpCopy2<Traits>(cs));
-         cs->addCompositeOp(new KoCompositeOpErase<Traits>(cs));
+         cs->addCompositeOp(OptimizedOpsSelector<Traits>::createEraseOp(cs));
          cs->addCompositeOp(new KoCompositeOpBehind<Traits>(cs));
          cs->addCompositeOp(new KoCompositeOpDestinationIn<Traits>(cs));
          cs->addCompositeOp(new KoCompositeOpDestinationAtop<Traits>(cs));
          cs->addCompositeOp(new KoCompositeOpGreater<Traits>(cs));
 
-         add<&cfOverlay<Arg>       >(cs, COMPOSITE_OVERLAY       , i18n("Overlay")       , KoCompositeOp::categoryMix());
+         cs->addCompositeOp(OptimizedOpsSelector<Traits>::createOverlayOp(cs));
          add<&cfGrainMerge<Arg>    >(cs, COMPOSITE_GRAIN_MERGE   , i18n("Grain Merge")   , KoCompositeOp::categoryMix());
          add<&cfGrainExtract<Arg>  >(cs, COMPOSITE_GRAIN_EXTRACT , i18n("Grain Extract") , KoCompositeOp::categoryMix());
          add<&cfHardMix<Arg>       >(cs, COMPOSITE_HARD_MIX      , i18n("Hard Mix")      , KoCompositeOp::categoryMix());
@@ -139,11 +249,11 @@ struct AddGeneralOps<Traits, true>
          add<&cfPenumbraC<Arg>     >(cs, COMPOSITE_PENUMBRAC     , i18n("Penumbra C")    , KoCompositeOp::categoryMix());
          add<&cfPenumbraD<Arg>     >(cs, COMPOSITE_PENUMBRAD     , i18n("Penumbra D")    , KoCompositeOp::categoryMix());
 
-         add<&cfScreen<Arg>      >(cs, COMPOSITE_SCREEN      , i18n("Screen")      , KoCompositeOp::categoryLight());
-         add<&cfColorDodge<Arg>  >(cs, COMPOSITE_DODGE       , i18n("Color Dodge") , KoCompositeOp::categoryLight());
-         add<&cfAddition<Arg>    >(cs, COMPOSITE_LINEAR_DODGE, i18n("Linear Dodge"), KoCompositeOp::categoryLight());
+         cs->addCompositeOp(OptimizedOpsSelector<Traits>::createScreenOp(cs));
+         cs->addCompositeOp(OptimizedOpsSelector<Traits>::createColorDodgeOp(cs));
+         cs->addCompositeOp(OptimizedOpsSelector<Traits>::createLinearDodgeOp(cs));
          add<&cfLightenOnly<Arg> >(cs, COMPOSITE_LIGHTEN     , i18n("Lighten")     , KoCompositeOp::categoryLight());
-         add<&cfHardLight<Arg>   >(cs, COMPOSITE_HARD_LIGHT  , i18n("Hard Light")  , KoCompositeOp::categoryLight());
+         cs->addCompositeOp(OptimizedOpsSelector<Traits>::createHardLightOp(cs));
          add<&cfSoftLightIFSIllusions<Arg>>(cs, COMPOSITE_SOFT_LIGHT_IFS_ILLUSIONS, i18n("Soft Light (IFS Illusions)")  , KoCompositeOp::categoryLight());
          add<&cfSoftLightPegtopDelphi<Arg>>(cs, COMPOSITE_SOFT_LIGHT_PEGTOP_DELPHI, i18n("Soft Light (Pegtop-Delphi)")  , KoCompositeOp::categoryLight());
          add<&cfSoftLightSvg<Arg>   >(cs, COMPOSITE_SOFT_LIGHT_SVG, i18n("Soft Light (SVG)")  , KoCompositeOp::categoryLight());
@@ -161,7 +271,7 @@ struct AddGeneralOps<Traits, true>
          add<&cfFogLightenIFSIllusions<Arg>     >(cs, COMPOSITE_FOG_LIGHTEN_IFS_ILLUSIONS     , i18n("Fog Lighten (IFS Illusions)")    , KoCompositeOp::categoryLight());
          add<&cfEasyDodge<Arg>  >(cs, COMPOSITE_EASY_DODGE       , i18n("Easy Dodge") , KoCompositeOp::categoryLight());
 
-         add<&cfColorBurn<Arg>  >(cs, COMPOSITE_BURN        , i18n("Color Burn") , KoCompositeOp::categoryDark());
+         cs->addCompositeOp(OptimizedOpsSelector<Traits>::createColorBurnOp(cs));
          add<&cfLinearBurn<Arg> >(cs, COMPOSITE_LINEAR_BURN , i18n("Linear Burn"), KoCompositeOp::categoryDark());
          add<&cfDarkenOnly<Arg> >(cs, COMPOSITE_DARKEN      , i18n("Darken")     , KoCompositeOp::categoryDark());
          add<&cfGammaDark<Arg>  >(cs, COMPOSITE_GAMMA_DARK  , i18n("Gamma Dark") , KoCompositeOp::categoryDark());
@@ -172,7 +282,7 @@ struct AddGeneralOps<Traits, true>
          add<&cfAddition<Arg>        >(cs, COMPOSITE_ADD             , i18n("Addition")         , KoCompositeOp::categoryArithmetic());
          add<&cfSubtract<Arg>        >(cs, COMPOSITE_SUBTRACT        , i18n("Subtract")         , KoCompositeOp::categoryArithmetic());
          add<&cfInverseSubtract<Arg> >(cs, COMPOSITE_INVERSE_SUBTRACT, i18n("Inversed-Subtract"), KoCompositeOp::categoryArithmetic());
-         add<&cfMultiply<Arg>        >(cs, COMPOSITE_MULT            , i18n("Multiply")         , KoCompositeOp::categoryArithmetic());
+         cs->addCompositeOp(OptimizedOpsSelector<Traits>::createMultiplyOp(cs));
          add<&cfDivide<Arg>          >(cs, COMPOSITE_DIVIDE          , i18n("Divide")           , KoCompositeOp::categoryArithmetic());
 
          add<&cfModulo<Arg>               >(cs, COMPOSITE_MOD                    , i18n("Modulo")                   , KoCompositeOp::categoryModulo());
@@ -50,3 +50,43 @@ KoCompositeOp* KoOptimizedCompositeOpFactory::createOverOp128(const KoColorSpace
 {
     return createOptimizedClass<KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpOver128> >(cs);
 }
+
+KoCompositeOp* KoOptimizedCompositeOpFactory::createMultiplyOp32(const KoColorSpace *cs)
+{
+    return createOptimizedClass<KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpMultiply32> >(cs);
+}
+
+KoCompositeOp* KoOptimizedCompositeOpFactory::createScreenOp32(const KoColorSpace *cs)
+{
+    return createOptimizedClass<KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpScreen32> >(cs);
+}
+
+KoCompositeOp* KoOptimizedCompositeOpFactory::createEraseOp32(const KoColorSpace *cs)
+{
+    return createOptimizedClass<KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpErase32> >(cs);
+}
+
+KoCompositeOp* KoOptimizedCompositeOpFactory::createColorDodgeOp32(const KoColorSpace *cs)
+{
+    return createOptimizedClass<KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpColorDodge32> >(cs);
+}
+
+KoCompositeOp* KoOptimizedCompositeOpFactory::createColorBurnOp32(const KoColorSpace *cs)
+{
+    return createOptimizedClass<KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpColorBurn32> >(cs);
+}
+
+KoCompositeOp* KoOptimizedCompositeOpFactory::createHardLightOp32(const KoColorSpace *cs)
+{
+    return createOptimizedClass<KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpHardLight32> >(cs);
+}
+
+KoCompositeOp* KoOptimizedCompositeOpFactory::createOverlayOp32(const KoColorSpace *cs)
+{
+    return createOptimizedClass<KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpOverlay32> >(cs);
+}
+
+KoCompositeOp* KoOptimizedCompositeOpFactory::createLinearDodgeOp32(const KoColorSpace *cs)
+{
+    return createOptimizedClass<KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpLinearDodge32> >(cs);
+}
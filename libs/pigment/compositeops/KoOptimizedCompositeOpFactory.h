@@ -33,6 +33,14 @@ public:
     static KoCompositeOp* createAlphaDarkenOpHard128(const KoColorSpace *cs);
     static KoCompositeOp* createAlphaDarkenOpCreamy128(const KoColorSpace *cs);
     static KoCompositeOp* createOverOp128(const KoColorSpace *cs);
+    static KoCompositeOp* createMultiplyOp32(const KoColorSpace *cs);
+    static KoCompositeOp* createScreenOp32(const KoColorSpace *cs);
+    static KoCompositeOp* createEraseOp32(const KoColorSpace *cs);
+    static KoCompositeOp* createColorDodgeOp32(const KoColorSpace *cs);
+    static KoCompositeOp* createColorBurnOp32(const KoColorSpace *cs);
+    static KoCompositeOp* createHardLightOp32(const KoColorSpace *cs);
+    static KoCompositeOp* createOverlayOp32(const KoColorSpace *cs);
+    static KoCompositeOp* createLinearDodgeOp32(const KoColorSpace *cs);
 };
 
 #endif /* KOOPTIMIZEDCOMPOSITEOPFACTORY_H */
@@ -33,6 +33,30 @@ class KoOptimizedCompositeOpAlphaDarkenCreamy128;
 template<Vc::Implementation _impl>
 class KoOptimizedCompositeOpOver128;
 
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpMultiply32;
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpScreen32;
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpErase32;
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpColorDodge32;
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpColorBurn32;
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpHardLight32;
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpOverlay32;
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpLinearDodge32;
+
 template<template<Vc::Implementation I> class CompositeOp>
 struct KoOptimizedCompositeOpFactoryPerArch
 {
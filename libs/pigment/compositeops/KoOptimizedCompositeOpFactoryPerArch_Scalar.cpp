@@ -10,6 +10,10 @@
 #include "KoCompositeOpAlphaDarken.h"
 #include "KoAlphaDarkenParamsWrapper.h"
 #include "KoCompositeOpOver.h"
+#include "KoCompositeOpGeneric.h"
+#include "KoCompositeOpErase.h"
+#include "KoCompositeOpRegistry.h"
+#include <klocalizedstring.h>
 
 template<>
 template<>
@@ -59,3 +63,74 @@ KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpOver128>::create<Vc::
 {
     return new KoCompositeOpOver<KoRgbF32Traits>(param);
 }
+
+template<>
+template<>
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpMultiply32>::ReturnType
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpMultiply32>::create<Vc::ScalarImpl>(ParamType param)
+{
+    return new KoCompositeOpGenericSC<KoBgrU8Traits, &cfMultiply<quint8> >(
+        param, COMPOSITE_MULT, i18n("Multiply"), KoCompositeOp::categoryArithmetic());
+}
+
+template<>
+template<>
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpScreen32>::ReturnType
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpScreen32>::create<Vc::ScalarImpl>(ParamType param)
+{
+    return new KoCompositeOpGenericSC<KoBgrU8Traits, &cfScreen<quint8> >(
+        param, COMPOSITE_SCREEN, i18n("Screen"), KoCompositeOp::categoryLight());
+}
+
+template<>
+template<>
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpErase32>::ReturnType
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpErase32>::create<Vc::ScalarImpl>(ParamType param)
+{
+    return new KoCompositeOpErase<KoBgrU8Traits>(param);
+}
+
+template<>
+template<>
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpColorDodge32>::ReturnType
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpColorDodge32>::create<Vc::ScalarImpl>(ParamType param)
+{
+    return new KoCompositeOpGenericSC<KoBgrU8Traits, &cfColorDodge<quint8> >(
+        param, COMPOSITE_DODGE, i18n("Color Dodge"), KoCompositeOp::categoryLight());
+}
+
+template<>
+template<>
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpColorBurn32>::ReturnType
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpColorBurn32>::create<Vc::ScalarImpl>(ParamType param)
+{
+    return new KoCompositeOpGenericSC<KoBgrU8Traits, &cfColorBurn<quint8> >(
+        param, COMPOSITE_BURN, i18n("Color Burn"), KoCompositeOp::categoryDark());
+}
+
+template<>
+template<>
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpHardLight32>::ReturnType
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpHardLight32>::create<Vc::ScalarImpl>(ParamType param)
+{
+    return new KoCompositeOpGenericSC<KoBgrU8Traits, &cfHardLight<quint8> >(
+        param, COMPOSITE_HARD_LIGHT, i18n("Hard Light"), KoCompositeOp::categoryLight());
+}
+
+template<>
+template<>
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpOverlay32>::ReturnType
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpOverlay32>::create<Vc::ScalarImpl>(ParamType param)
+{
+    return new KoCompositeOpGenericSC<KoBgrU8Traits, &cfOverlay<quint8> >(
+        param, COMPOSITE_OVERLAY, i18n("Overlay"), KoCompositeOp::categoryMix());
+}
+
+template<>
+template<>
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpLinearDodge32>::ReturnType
+KoOptimizedCompositeOpFactoryPerArch<KoOptimizedCompositeOpLinearDodge32>::create<Vc::ScalarImpl>(ParamType param)
+{
+    return new KoCompositeOpGenericSC<KoBgrU8Traits, &cfAddition<quint8> >(
+        param, COMPOSITE_LINEAR_DODGE, i18n("Linear Dodge"), KoCompositeOp::categoryLight());
+}
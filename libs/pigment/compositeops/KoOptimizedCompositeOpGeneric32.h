@@ -0,0 +1,492 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Krita contributors
+ *
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ */
+
+#ifndef KOOPTIMIZEDCOMPOSITEOPGENERIC32_H_
+#define KOOPTIMIZEDCOMPOSITEOPGENERIC32_H_
+
+#include "KoCompositeOpBase.h"
+#include "KoCompositeOpRegistry.h"
+#include "KoStreamedMath.h"
+#include "KoOptimizedCompositeOpOver32.h" // for OptiDiv
+
+/**
+ * Streamed implementations of the separable blend modes that used to
+ * run only through the scalar per-channel templates of
+ * KoCompositeOpGeneric.h. The alpha composition replicates
+ * KoCompositeOpGenericSC: the new alpha is the union of the shape
+ * opacities and the channels are mixed with the
+ * srcAlpha*dstAlpha/srcAlpha*(1-dstAlpha)/(1-srcAlpha)*dstAlpha
+ * coefficients.
+ *
+ * The blend mode itself is a small functor working on normalized
+ * [0.0...1.0] values, so adding another separable mode costs a couple
+ * of lines.
+ */
+
+template<Vc::Implementation _impl>
+struct MultiplyBlendMode {
+    static ALWAYS_INLINE Vc::float_v blend(Vc::float_v::AsArg src, Vc::float_v::AsArg dst) {
+        return src * dst;
+    }
+    static ALWAYS_INLINE float blendScalar(float src, float dst) {
+        return src * dst;
+    }
+};
+
+template<Vc::Implementation _impl>
+struct ScreenBlendMode {
+    static ALWAYS_INLINE Vc::float_v blend(Vc::float_v::AsArg src, Vc::float_v::AsArg dst) {
+        return src + dst - src * dst;
+    }
+    static ALWAYS_INLINE float blendScalar(float src, float dst) {
+        return src + dst - src * dst;
+    }
+};
+
+template<Vc::Implementation _impl>
+struct ColorDodgeBlendMode {
+    static ALWAYS_INLINE Vc::float_v blend(Vc::float_v::AsArg src, Vc::float_v::AsArg dst) {
+        const Vc::float_v oneValue(Vc::One);
+        const Vc::float_v zeroValue(Vc::Zero);
+        const Vc::float_v invSrc = oneValue - src;
+
+        const Vc::float_v result =
+            Vc::min(oneValue, OptiDiv<_impl>::divVector(dst, invSrc));
+
+        /**
+         * invSrc == 0 lanes must be pinned to 1 explicitly: with
+         * dst == 0 the division yields NaN, not +inf, and would
+         * otherwise leak through the clamp. This mirrors the
+         * "avoid ZX colors" fixup of cfColorDodge().
+         */
+        return Vc::iif(invSrc == zeroValue, oneValue, result);
+    }
+    static ALWAYS_INLINE float blendScalar(float src, float dst) {
+        if (src >= 1.0f) return 1.0f;
+        return qMin(1.0f, OptiDiv<_impl>::divScalar(dst, 1.0f - src));
+    }
+};
+
+template<Vc::Implementation _impl>
+struct ColorBurnBlendMode {
+    static ALWAYS_INLINE Vc::float_v blend(Vc::float_v::AsArg src, Vc::float_v::AsArg dst) {
+        const Vc::float_v oneValue(Vc::One);
+        const Vc::float_v zeroValue(Vc::Zero);
+        const Vc::float_v invDst = oneValue - dst;
+
+        const Vc::float_v result =
+            oneValue - Vc::min(oneValue, OptiDiv<_impl>::divVector(invDst, src));
+
+        // dst == 1 must win over the 0/0 case
+        return Vc::iif(invDst == zeroValue, oneValue, result);
+    }
+    static ALWAYS_INLINE float blendScalar(float src, float dst) {
+        if (dst >= 1.0f) return 1.0f;
+        if (src <= 0.0f) return 0.0f;
+        return 1.0f - qMin(1.0f, OptiDiv<_impl>::divScalar(1.0f - dst, src));
+    }
+};
+
+template<Vc::Implementation _impl>
+struct HardLightBlendMode {
+    static ALWAYS_INLINE Vc::float_v blend(Vc::float_v::AsArg src, Vc::float_v::AsArg dst) {
+        const Vc::float_v oneValue(Vc::One);
+        const Vc::float_v halfValue(0.5f);
+
+        const Vc::float_v src2 = src + src;
+        const Vc::float_v screenPart = src2 - oneValue;
+
+        return Vc::iif(src > halfValue,
+                       screenPart + dst - screenPart * dst,
+                       src2 * dst);
+    }
+    static ALWAYS_INLINE float blendScalar(float src, float dst) {
+        if (src > 0.5f) {
+            const float screenPart = 2.0f * src - 1.0f;
+            return screenPart + dst - screenPart * dst;
+        }
+        return 2.0f * src * dst;
+    }
+};
+
+template<Vc::Implementation _impl>
+struct OverlayBlendMode {
+    static ALWAYS_INLINE Vc::float_v blend(Vc::float_v::AsArg src, Vc::float_v::AsArg dst) {
+        return HardLightBlendMode<_impl>::blend(dst, src);
+    }
+    static ALWAYS_INLINE float blendScalar(float src, float dst) {
+        return HardLightBlendMode<_impl>::blendScalar(dst, src);
+    }
+};
+
+template<Vc::Implementation _impl>
+struct LinearDodgeBlendMode {
+    static ALWAYS_INLINE Vc::float_v blend(Vc::float_v::AsArg src, Vc::float_v::AsArg dst) {
+        return Vc::min(Vc::float_v(Vc::One), src + dst);
+    }
+    static ALWAYS_INLINE float blendScalar(float src, float dst) {
+        return qMin(1.0f, src + dst);
+    }
+};
+
+template<template<Vc::Implementation I> class BlendMode,
+         typename channels_type, typename pixel_type,
+         bool alphaLocked, bool allChannelsFlag>
+struct GenericSeparableCompositor32 {
+    struct ParamsWrapper {
+        ParamsWrapper(const KoCompositeOp::ParameterInfo& params)
+            : channelFlags(params.channelFlags)
+        {
+        }
+        const QBitArray &channelFlags;
+    };
+
+    // \see docs in AlphaDarkenCompositor32
+    template<bool haveMask, bool src_aligned, Vc::Implementation _impl>
+    static ALWAYS_INLINE void compositeVector(const quint8 *src, quint8 *dst, const quint8 *mask, float opacity, const ParamsWrapper &oparams)
+    {
+        Q_UNUSED(oparams);
+
+        Vc::float_v uint8MaxRec1((float)1.0 / 255.0);
+        Vc::float_v uint8Max((float)255.0);
+        Vc::float_v zeroValue(Vc::Zero);
+        Vc::float_v oneValue(Vc::One);
+
+        Vc::float_v src_alpha =
+            KoStreamedMath<_impl>::template fetch_alpha_32<src_aligned>(src) * uint8MaxRec1;
+
+        src_alpha *= Vc::float_v(opacity);
+
+        if (haveMask) {
+            Vc::float_v mask_vec = KoStreamedMath<_impl>::fetch_mask_8(mask);
+            src_alpha *= mask_vec * uint8MaxRec1;
+        }
+
+        Vc::float_v dst_alpha =
+            KoStreamedMath<_impl>::template fetch_alpha_32<true>(dst) * uint8MaxRec1;
+
+        // transparent src does not change the blend result, but the
+        // dst alpha still stays intact, so we can simply skip
+        if ((src_alpha == zeroValue).isFull()) {
+            return;
+        }
+
+        Vc::float_v src_c1;
+        Vc::float_v src_c2;
+        Vc::float_v src_c3;
+
+        Vc::float_v dst_c1;
+        Vc::float_v dst_c2;
+        Vc::float_v dst_c3;
+
+        KoStreamedMath<_impl>::template fetch_colors_32<src_aligned>(src, src_c1, src_c2, src_c3);
+        KoStreamedMath<_impl>::template fetch_colors_32<true>(dst, dst_c1, dst_c2, dst_c3);
+
+        src_c1 *= uint8MaxRec1;
+        src_c2 *= uint8MaxRec1;
+        src_c3 *= uint8MaxRec1;
+
+        dst_c1 *= uint8MaxRec1;
+        dst_c2 *= uint8MaxRec1;
+        dst_c3 *= uint8MaxRec1;
+
+        const Vc::float_v new_alpha =
+            src_alpha + dst_alpha - src_alpha * dst_alpha;
+
+        const Vc::float_v coef_sd = src_alpha * dst_alpha;
+        const Vc::float_v coef_s = src_alpha * (oneValue - dst_alpha);
+        const Vc::float_v coef_d = dst_alpha * (oneValue - src_alpha);
+
+        /**
+         * new_alpha can contain zero values, whose division results
+         * in NaNs; they become zeroes when converted back to
+         * integers, which is exactly what is needed (see the note in
+         * OverCompositor32)
+         */
+        const Vc::float_v recip_alpha = OptiDiv<_impl>::divVector(oneValue, new_alpha);
+
+        dst_c1 = (coef_sd * BlendMode<_impl>::blend(src_c1, dst_c1) + coef_s * src_c1 + coef_d * dst_c1) * recip_alpha;
+        dst_c2 = (coef_sd * BlendMode<_impl>::blend(src_c2, dst_c2) + coef_s * src_c2 + coef_d * dst_c2) * recip_alpha;
+        dst_c3 = (coef_sd * BlendMode<_impl>::blend(src_c3, dst_c3) + coef_s * src_c3 + coef_d * dst_c3) * recip_alpha;
+
+        KoStreamedMath<_impl>::write_channels_32(dst,
+                                                 new_alpha * uint8Max,
+                                                 dst_c1 * uint8Max,
+                                                 dst_c2 * uint8Max,
+                                                 dst_c3 * uint8Max);
+    }
+
+    template <bool haveMask, Vc::Implementation _impl>
+    static ALWAYS_INLINE void compositeOnePixelScalar(const channels_type *src, channels_type *dst, const quint8 *mask, float opacity, const ParamsWrapper &oparams)
+    {
+        const qint32 alpha_pos = 3;
+
+        const float uint8Rec1 = 1.0 / 255.0;
+        const float uint8Max = 255.0;
+
+        float srcAlpha = src[alpha_pos] * uint8Rec1;
+        srcAlpha *= opacity;
+
+        if (haveMask) {
+            srcAlpha *= float(*mask) * uint8Rec1;
+        }
+
+        if (srcAlpha == 0.0) return;
+
+        float dstAlpha = dst[alpha_pos] * uint8Rec1;
+
+        if (alphaLocked) {
+            if (dstAlpha == 0.0) return;
+
+            for (qint32 i = 0; i < 3; i++) {
+                if (allChannelsFlag || oparams.channelFlags.at(i)) {
+                    const float srcC = src[i] * uint8Rec1;
+                    const float dstC = dst[i] * uint8Rec1;
+                    const float blended = BlendMode<_impl>::blendScalar(srcC, dstC);
+
+                    dst[i] = KoStreamedMath<_impl>::round_float_to_uint(
+                        (dstC + srcAlpha * (blended - dstC)) * uint8Max);
+                }
+            }
+        } else {
+            const float newAlpha = srcAlpha + dstAlpha - srcAlpha * dstAlpha;
+
+            if (newAlpha != 0.0) {
+                const float coefSD = srcAlpha * dstAlpha;
+                const float coefS = srcAlpha * (1.0f - dstAlpha);
+                const float coefD = dstAlpha * (1.0f - srcAlpha);
+                const float recipAlpha = OptiDiv<_impl>::divScalar(1.0f, newAlpha);
+
+                for (qint32 i = 0; i < 3; i++) {
+                    if (allChannelsFlag || oparams.channelFlags.at(i)) {
+                        const float srcC = src[i] * uint8Rec1;
+                        const float dstC = dst[i] * uint8Rec1;
+                        const float blended = BlendMode<_impl>::blendScalar(srcC, dstC);
+
+                        dst[i] = KoStreamedMath<_impl>::round_float_to_uint(
+                            (coefSD * blended + coefS * srcC + coefD * dstC) * recipAlpha * uint8Max);
+                    }
+                }
+            }
+
+            dst[alpha_pos] = KoStreamedMath<_impl>::round_float_to_uint(newAlpha * uint8Max);
+        }
+    }
+};
+
+/**
+ * The erase op only diminishes the destination alpha by the source
+ * alpha, so its vector form is a pure alpha pipeline.
+ */
+template<typename channels_type, typename pixel_type,
+         bool alphaLocked, bool allChannelsFlag>
+struct EraseCompositor32 {
+    struct ParamsWrapper {
+        ParamsWrapper(const KoCompositeOp::ParameterInfo& params)
+            : channelFlags(params.channelFlags)
+        {
+        }
+        const QBitArray &channelFlags;
+    };
+
+    template<bool haveMask, bool src_aligned, Vc::Implementation _impl>
+    static ALWAYS_INLINE void compositeVector(const quint8 *src, quint8 *dst, const quint8 *mask, float opacity, const ParamsWrapper &oparams)
+    {
+        Q_UNUSED(oparams);
+
+        Vc::float_v uint8MaxRec1((float)1.0 / 255.0);
+        Vc::float_v oneValue(Vc::One);
+
+        Vc::float_v src_alpha =
+            KoStreamedMath<_impl>::template fetch_alpha_32<src_aligned>(src) * uint8MaxRec1;
+
+        src_alpha *= Vc::float_v(opacity);
+
+        if (haveMask) {
+            Vc::float_v mask_vec = KoStreamedMath<_impl>::fetch_mask_8(mask);
+            src_alpha *= mask_vec * uint8MaxRec1;
+        }
+
+        Vc::float_v dst_alpha =
+            KoStreamedMath<_impl>::template fetch_alpha_32<true>(dst);
+
+        Vc::float_v dst_c1;
+        Vc::float_v dst_c2;
+        Vc::float_v dst_c3;
+
+        KoStreamedMath<_impl>::template fetch_colors_32<true>(dst, dst_c1, dst_c2, dst_c3);
+
+        dst_alpha *= oneValue - src_alpha;
+
+        KoStreamedMath<_impl>::write_channels_32(dst, dst_alpha, dst_c1, dst_c2, dst_c3);
+    }
+
+    template <bool haveMask, Vc::Implementation _impl>
+    static ALWAYS_INLINE void compositeOnePixelScalar(const channels_type *src, channels_type *dst, const quint8 *mask, float opacity, const ParamsWrapper &oparams)
+    {
+        Q_UNUSED(oparams);
+
+        const qint32 alpha_pos = 3;
+        const float uint8Rec1 = 1.0 / 255.0;
+
+        float srcAlpha = src[alpha_pos] * uint8Rec1;
+        srcAlpha *= opacity;
+
+        if (haveMask) {
+            srcAlpha *= float(*mask) * uint8Rec1;
+        }
+
+        dst[alpha_pos] = KoStreamedMath<_impl>::round_float_to_uint(
+            dst[alpha_pos] * (1.0f - srcAlpha));
+    }
+};
+
+/**
+ * The shared composite() dispatcher of the generic streamed ops; the
+ * same flag handling as in KoOptimizedCompositeOpOver32.
+ */
+#define KO_STREAMED_GENERIC_COMPOSITE(CompositorTemplate)               \
+    using KoCompositeOp::composite;                                     \
+                                                                        \
+    virtual void composite(const KoCompositeOp::ParameterInfo& params) const \
+    {                                                                   \
+        if(params.maskRowStart) {                                       \
+            composite<true>(params);                                    \
+        } else {                                                        \
+            composite<false>(params);                                   \
+        }                                                               \
+    }                                                                   \
+                                                                        \
+    template <bool haveMask>                                            \
+    inline void composite(const KoCompositeOp::ParameterInfo& params) const { \
+        if (params.channelFlags.isEmpty() ||                            \
+            params.channelFlags == QBitArray(4, true)) {                \
+                                                                        \
+            KoStreamedMath<_impl>::template genericComposite32<haveMask, false, CompositorTemplate<quint8, quint32, false, true> >(params); \
+        } else {                                                        \
+            const bool allChannelsFlag =                                \
+                params.channelFlags.at(0) &&                            \
+                params.channelFlags.at(1) &&                            \
+                params.channelFlags.at(2);                              \
+                                                                        \
+            const bool alphaLocked =                                    \
+                !params.channelFlags.at(3);                             \
+                                                                        \
+            if (allChannelsFlag && alphaLocked) {                       \
+                KoStreamedMath<_impl>::template genericComposite32_novector<haveMask, false, CompositorTemplate<quint8, quint32, true, true> >(params); \
+            } else if (!allChannelsFlag && !alphaLocked) {              \
+                KoStreamedMath<_impl>::template genericComposite32_novector<haveMask, false, CompositorTemplate<quint8, quint32, false, false> >(params); \
+            } else /*if (!allChannelsFlag && alphaLocked) */{           \
+                KoStreamedMath<_impl>::template genericComposite32_novector<haveMask, false, CompositorTemplate<quint8, quint32, true, false> >(params); \
+            }                                                           \
+        }                                                               \
+    }
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpMultiply32 : public KoCompositeOp
+{
+    template<typename channels_type, typename pixel_type, bool alphaLocked, bool allChannelsFlag>
+    using Compositor = GenericSeparableCompositor32<MultiplyBlendMode, channels_type, pixel_type, alphaLocked, allChannelsFlag>;
+
+public:
+    KoOptimizedCompositeOpMultiply32(const KoColorSpace* cs)
+        : KoCompositeOp(cs, COMPOSITE_MULT, i18n("Multiply"), KoCompositeOp::categoryArithmetic()) {}
+
+    KO_STREAMED_GENERIC_COMPOSITE(Compositor)
+};
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpScreen32 : public KoCompositeOp
+{
+    template<typename channels_type, typename pixel_type, bool alphaLocked, bool allChannelsFlag>
+    using Compositor = GenericSeparableCompositor32<ScreenBlendMode, channels_type, pixel_type, alphaLocked, allChannelsFlag>;
+
+public:
+    KoOptimizedCompositeOpScreen32(const KoColorSpace* cs)
+        : KoCompositeOp(cs, COMPOSITE_SCREEN, i18n("Screen"), KoCompositeOp::categoryLight()) {}
+
+    KO_STREAMED_GENERIC_COMPOSITE(Compositor)
+};
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpColorDodge32 : public KoCompositeOp
+{
+    template<typename channels_type, typename pixel_type, bool alphaLocked, bool allChannelsFlag>
+    using Compositor = GenericSeparableCompositor32<ColorDodgeBlendMode, channels_type, pixel_type, alphaLocked, allChannelsFlag>;
+
+public:
+    KoOptimizedCompositeOpColorDodge32(const KoColorSpace* cs)
+        : KoCompositeOp(cs, COMPOSITE_DODGE, i18n("Color Dodge"), KoCompositeOp::categoryLight()) {}
+
+    KO_STREAMED_GENERIC_COMPOSITE(Compositor)
+};
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpColorBurn32 : public KoCompositeOp
+{
+    template<typename channels_type, typename pixel_type, bool alphaLocked, bool allChannelsFlag>
+    using Compositor = GenericSeparableCompositor32<ColorBurnBlendMode, channels_type, pixel_type, alphaLocked, allChannelsFlag>;
+
+public:
+    KoOptimizedCompositeOpColorBurn32(const KoColorSpace* cs)
+        : KoCompositeOp(cs, COMPOSITE_BURN, i18n("Color Burn"), KoCompositeOp::categoryDark()) {}
+
+    KO_STREAMED_GENERIC_COMPOSITE(Compositor)
+};
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpHardLight32 : public KoCompositeOp
+{
+    template<typename channels_type, typename pixel_type, bool alphaLocked, bool allChannelsFlag>
+    using Compositor = GenericSeparableCompositor32<HardLightBlendMode, channels_type, pixel_type, alphaLocked, allChannelsFlag>;
+
+public:
+    KoOptimizedCompositeOpHardLight32(const KoColorSpace* cs)
+        : KoCompositeOp(cs, COMPOSITE_HARD_LIGHT, i18n("Hard Light"), KoCompositeOp::categoryLight()) {}
+
+    KO_STREAMED_GENERIC_COMPOSITE(Compositor)
+};
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpOverlay32 : public KoCompositeOp
+{
+    template<typename channels_type, typename pixel_type, bool alphaLocked, bool allChannelsFlag>
+    using Compositor = GenericSeparableCompositor32<OverlayBlendMode, channels_type, pixel_type, alphaLocked, allChannelsFlag>;
+
+public:
+    KoOptimizedCompositeOpOverlay32(const KoColorSpace* cs)
+        : KoCompositeOp(cs, COMPOSITE_OVERLAY, i18n("Overlay"), KoCompositeOp::categoryMix()) {}
+
+    KO_STREAMED_GENERIC_COMPOSITE(Compositor)
+};
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpLinearDodge32 : public KoCompositeOp
+{
+    template<typename channels_type, typename pixel_type, bool alphaLocked, bool allChannelsFlag>
+    using Compositor = GenericSeparableCompositor32<LinearDodgeBlendMode, channels_type, pixel_type, alphaLocked, allChannelsFlag>;
+
+public:
+    KoOptimizedCompositeOpLinearDodge32(const KoColorSpace* cs)
+        : KoCompositeOp(cs, COMPOSITE_LINEAR_DODGE, i18n("Linear Dodge"), KoCompositeOp::categoryLight()) {}
+
+    KO_STREAMED_GENERIC_COMPOSITE(Compositor)
+};
+
+template<Vc::Implementation _impl>
+class KoOptimizedCompositeOpErase32 : public KoCompositeOp
+{
+    template<typename channels_type, typename pixel_type, bool alphaLocked, bool allChannelsFlag>
+    using Compositor = EraseCompositor32<channels_type, pixel_type, alphaLocked, allChannelsFlag>;
+
+public:
+    KoOptimizedCompositeOpErase32(const KoColorSpace* cs)
+        : KoCompositeOp(cs, COMPOSITE_ERASE, i18n("Erase"), KoCompositeOp::categoryMix()) {}
+
+    KO_STREAMED_GENERIC_COMPOSITE(Compositor)
+};
+
+#endif // KOOPTIMIZEDCOMPOSITEOPGENERIC32_H_
@@ -80,6 +80,25 @@ QSqlError createDatabase(const QString &location)
         return db.lastError();
     }
 
+    /**
+     * WAL mode turns every resource-import INSERT from a full
+     * database rewrite-and-fsync into an append to the write-ahead
+     * log, which is the difference between minutes and seconds when
+     * importing bundles onto network home directories; NORMAL
+     * synchronous is the documented safe setting for WAL (the log
+     * protects the main database file). Harmless no-ops on the
+     * in-memory test databases.
+     */
+    {
+        QSqlQuery pragmaQuery;
+        if (!pragmaQuery.exec("PRAGMA journal_mode = WAL;")) {
+            qWarning() << "Could not switch the resource cache database to WAL mode" << pragmaQuery.lastError();
+        }
+        if (!pragmaQuery.exec("PRAGMA synchronous = NORMAL;")) {
+            qWarning() << "Could not set synchronous mode on the resource cache database" << pragmaQuery.lastError();
+        }
+    }
+
     QStringList tables = QStringList() << "version_information"
                                        << "storage_types"
                                        << "resource_types"
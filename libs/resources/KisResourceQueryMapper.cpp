@@ -9,6 +9,7 @@
 #include <QImage>
 #include <QByteArray>
 #include <QBuffer>
+#include <QHash>
 #include <QDebug>
 #include <QSqlError>
 
@@ -17,6 +18,49 @@
 #include "KisResourceModelProvider.h"
 #include "KisTag.h"
 
+namespace {
+/**
+ * The views re-request the decoration role for the visible items on
+ * every repaint, and decoding the PNG thumbnail blob each time is
+ * what made scrolling big preset libraries stall. The decoded images
+ * are cached per resource id with a CRC of the blob as the validity
+ * check (orders of magnitude cheaper than the PNG decode), since
+ * updating a resource rewrites its thumbnail.
+ * Models live on the GUI thread, so no locking is needed.
+ */
+QImage decodeThumbnailCached(int resourceId, const QByteArray &ba)
+{
+    struct Entry {
+        quint16 blobChecksum;
+        QImage image;
+    };
+    static QHash<int, Entry> cache;
+    static const int maxCachedThumbnails = 4096;
+
+    const quint16 checksum = qChecksum(ba.constData(), ba.size());
+
+    const auto it = cache.constFind(resourceId);
+    if (it != cache.constEnd() && it->blobChecksum == checksum) {
+        return it->image;
+    }
+
+    QImage img;
+    if (!ba.isEmpty()) {
+        QBuffer buf(const_cast<QByteArray*>(&ba));
+        buf.open(QBuffer::ReadOnly);
+        img.load(&buf, "PNG");
+    }
+
+    if (cache.size() >= maxCachedThumbnails) {
+        cache.clear();
+    }
+    cache.insert(resourceId, {checksum, img});
+
+    return img;
+}
+}
+
+
 QVariant KisResourceQueryMapper::variantFromResourceQuery(const QSqlQuery &query, int column, int role)
 {
     const QString resourceType = query.value("resource_type").toString();
@@ -38,12 +82,8 @@ QVariant KisResourceQueryMapper::variantFromResourceQuery(const QSqlQuery &query
             return query.value("tooltip");
         case KisAbstractResourceModel::Thumbnail:
         {
-            QByteArray ba = query.value("thumbnail").toByteArray();
-            QBuffer buf(&ba);
-            buf.open(QBuffer::ReadOnly);
-            QImage img;
-            img.load(&buf, "PNG");
-            return QVariant::fromValue<QImage>(img);
+            const QByteArray ba = query.value("thumbnail").toByteArray();
+            return QVariant::fromValue<QImage>(decodeThumbnailCached(query.value("id").toInt(), ba));
         }
         case KisAbstractResourceModel::Status:
             return query.value("status");
@@ -63,14 +103,9 @@ QVariant KisResourceQueryMapper::variantFromResourceQuery(const QSqlQuery &query
     case Qt::DecorationRole:
     {
         if (column == KisAbstractResourceModel::Thumbnail) {
-            QByteArray ba = query.value("thumbnail").toByteArray();
+            const QByteArray ba = query.value("thumbnail").toByteArray();
             Q_ASSERT(!ba.isEmpty());
-            QBuffer buf(&ba);
-            buf.open(QBuffer::ReadOnly);
-            QImage img;
-            img.load(&buf, "PNG");
-            Q_ASSERT(!img.isNull());
-            return QVariant::fromValue<QImage>(img);
+            return QVariant::fromValue<QImage>(decodeThumbnailCached(query.value("id").toInt(), ba));
         }
         return QVariant();
     }
@@ -92,12 +127,8 @@ QVariant KisResourceQueryMapper::variantFromResourceQuery(const QSqlQuery &query
         return query.value("tooltip");
     case Qt::UserRole + KisAbstractResourceModel::Thumbnail:
     {
-        QByteArray ba = query.value("thumbnail").toByteArray();
-        QBuffer buf(&ba);
-        buf.open(QBuffer::ReadOnly);
-        QImage img;
-        img.load(&buf, "PNG");
-        return QVariant::fromValue<QImage>(img);
+        const QByteArray ba = query.value("thumbnail").toByteArray();
+        return QVariant::fromValue<QImage>(decodeThumbnailCached(query.value("id").toInt(), ba));
     }
     case Qt::UserRole + KisAbstractResourceModel::Status:
         return query.value("status");
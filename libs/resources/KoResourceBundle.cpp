@@ -24,6 +24,8 @@
 #include <KoMD5Generator.h>
 #include <KoResourcePaths.h>
 #include <KoStore.h>
+#include <QMutexLocker>
+#include <QFileInfo>
 #include <KoXmlReader.h>
 #include <KoXmlWriter.h>
 #include "KisStoragePlugin.h"
@@ -169,6 +171,13 @@ bool KoResourceBundle::save()
 {
     if (m_filename.isEmpty()) return false;
 
+    {
+        // drop the cached read store: rewriting the bundle while a
+        // read handle is open fails on Windows
+        QMutexLocker storeLocker(&m_storeMutex);
+        m_cachedResourceStore.reset();
+    }
+
     setMetaData(KisResourceStorage::s_meta_dc_date, QDate::currentDate().toString("dd/MM/yyyy"));
 
     QDir bundleDir = KoResourcePaths::saveLocation("data", "bundles");
@@ -403,14 +412,31 @@ KoResourceSP KoResourceBundle::resource(const QString &resourceType, const QStri
 {
     if (m_filename.isEmpty()) return 0;
 
-
-    QScopedPointer<KoStore> resourceStore(KoStore::createStore(m_filename, KoStore::Read, "application/x-krita-resourcebundle", KoStore::Zip));
-
-    if (!resourceStore || resourceStore->bad()) {
-        qWarning() << "Could not open store on bundle" << m_filename;
-        return 0;
+    /**
+     * Opening a zip store parses the whole central directory, and
+     * this function used to do that for every single resource
+     * lookup, which dominated both startup and first-use-of-brush
+     * latency. Keep the parsed store cached and only rebuild it when
+     * the bundle file's timestamp changes; the stat() per call is
+     * noise compared to the directory parse it replaces.
+     */
+    QMutexLocker storeLocker(&m_storeMutex);
+
+    const QDateTime bundleLastModified = QFileInfo(m_filename).lastModified();
+
+    if (!m_cachedResourceStore || m_cachedStoreModified != bundleLastModified) {
+        m_cachedResourceStore.reset(KoStore::createStore(m_filename, KoStore::Read, "application/x-krita-resourcebundle", KoStore::Zip));
+        m_cachedStoreModified = bundleLastModified;
+
+        if (!m_cachedResourceStore || m_cachedResourceStore->bad()) {
+            m_cachedResourceStore.reset();
+            qWarning() << "Could not open store on bundle" << m_filename;
+            return 0;
+        }
     }
 
+    KoStore *resourceStore = m_cachedResourceStore.data();
+
     if (!resourceStore->open(filepath)) {
         qWarning() << "Could not open file in bundle" << filepath;
         return 0;
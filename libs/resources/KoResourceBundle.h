@@ -10,6 +10,9 @@
 #include <QSet>
 #include <QList>
 #include <QSharedPointer>
+#include <QScopedPointer>
+#include <QDateTime>
+#include <QMutex>
 
 #include <KoXmlWriter.h>
 
@@ -122,6 +125,11 @@ private:
     QList<QByteArray> m_workspacesMd5Installed;
     QList<QByteArray> m_presetsMd5Installed;
     QString m_filename;
+
+    // cached read store for resource(); see the comment there
+    QScopedPointer<KoStore> m_cachedResourceStore;
+    QDateTime m_cachedStoreModified;
+    QMutex m_storeMutex;
     QString m_bundleVersion;
 
 };
@@ -6,6 +6,8 @@
 
 #include "KisAsyncAnimationFramesSavingRenderer.h"
 
+#include <QtConcurrent>
+
 #include "kis_image.h"
 #include "kis_paint_device.h"
 #include "KisImportExportFilter.h"
@@ -45,6 +47,7 @@ struct KisAsyncAnimationFramesSavingRenderer::Private
 
     QScopedPointer<KisDocument> savingDoc;
     KisPaintDeviceSP savingDevice;
+    QFuture<void> lastEncodeTask;
 
     KisTimeSpan range;
     int sequenceNumberingOffset = 0;
@@ -81,6 +84,7 @@ KisAsyncAnimationFramesSavingRenderer::KisAsyncAnimationFramesSavingRenderer(Kis
 
 KisAsyncAnimationFramesSavingRenderer::~KisAsyncAnimationFramesSavingRenderer()
 {
+    m_d->lastEncodeTask.waitForFinished();
 }
 
 void KisAsyncAnimationFramesSavingRenderer::frameCompletedCallback(int frame, const KisRegion &requestedRegion)
@@ -95,24 +99,17 @@ void KisAsyncAnimationFramesSavingRenderer::frameCompletedCallback(int frame, co
 
     m_d->savingDevice->makeCloneFromRough(image->projection(), image->bounds());
 
-    KisImportExportErrorCode status = ImportExportCodes::OK;
-
     QString frameNumber = QString("%1").arg(frame + m_d->sequenceNumberingOffset, 4, 10, QChar('0'));
     QString filename = m_d->filenamePrefix + frameNumber + m_d->filenameSuffix;
 
-    if (!m_d->savingDoc->exportDocumentSync(QUrl::fromLocalFile(filename), m_d->outputMimeType, m_d->exportConfiguration)) {
-        status = ImportExportCodes::InternalError;
-    }
-
     //Get all identical frames to this one and either copy or symlink based on settings.
+    QStringList identicalFrameNames;
     KisTimeSpan identicals = KisTimeSpan::calculateIdenticalFramesRecursive(image->root(), frame);
     identicals &= m_d->range;
     if( !m_d->onlyNeedsUniqueFrames && identicals.start() < identicals.end() ) {
         for (int identicalFrame = (identicals.start() + 1); identicalFrame <= identicals.end(); identicalFrame++) {
             QString identicalFrameNumber = QString("%1").arg(identicalFrame + m_d->sequenceNumberingOffset, 4, 10, QChar('0'));
-            QString identicalFrameName = m_d->filenamePrefix + identicalFrameNumber + m_d->filenameSuffix;
-
-            QFile::copy(filename, identicalFrameName);
+            identicalFrameNames << m_d->filenamePrefix + identicalFrameNumber + m_d->filenameSuffix;
 
             /*  This would be nice to do but sym-linking on windows isn't possible without
              *  way more other work to be done. This works on linux though!
@@ -126,11 +123,31 @@ void KisAsyncAnimationFramesSavingRenderer::frameCompletedCallback(int frame, co
         }
     }
 
-    if (status.isOk()) {
-        emit sigCompleteRegenerationInternal(frame);
-    } else {
-        emit sigCancelRegenerationInternal(frame);
-    }
+    /**
+     * Encode on the pool, so the next frame can be rendered (and the
+     * sibling renderers' frames encoded) while this one is written
+     * out. The base class does not hand this renderer another frame
+     * until the completion signal fires, so m_d->savingDevice and
+     * m_d->savingDoc stay exclusive to this task; the destructor
+     * waits for the task before tearing the document down.
+     */
+    m_d->lastEncodeTask = QtConcurrent::run([this, frame, filename, identicalFrameNames] () {
+        KisImportExportErrorCode status = ImportExportCodes::OK;
+
+        if (!m_d->savingDoc->exportDocumentSync(QUrl::fromLocalFile(filename), m_d->outputMimeType, m_d->exportConfiguration)) {
+            status = ImportExportCodes::InternalError;
+        }
+
+        Q_FOREACH (const QString &identicalFrameName, identicalFrameNames) {
+            QFile::copy(filename, identicalFrameName);
+        }
+
+        if (status.isOk()) {
+            emit sigCompleteRegenerationInternal(frame);
+        } else {
+            emit sigCancelRegenerationInternal(frame);
+        }
+    });
 }
 
 void KisAsyncAnimationFramesSavingRenderer::frameCancelledCallback(int frame)
@@ -20,6 +20,7 @@
 #include <QFileInfo>
 #include <QDateTime>
 #include <QImage>
+#include <QtConcurrent>
 #include <QPixmap>
 #include <QHeaderView>
 #include <QStyledItemDelegate>
@@ -195,6 +196,28 @@ KisAutoSaveRecoveryDialog::KisAutoSaveRecoveryDialog(const QStringList &filename
         QString path = QDir::homePath() + "/" + filename;
 #endif
 
+        // get the date
+        QDateTime date = QFileInfo(path).lastModified();
+        file->date = "(" + date.toString(Qt::LocalDate) + ")";
+
+        fileItems.append(file);
+    }
+
+    /**
+     * Opening the archives and decoding the embedded previews is the
+     * slow part (dozens of large autosaves were previously opened
+     * serially on the GUI thread before the dialog could show), and
+     * every file is independent, so decode them on the pool. The
+     * dialog construction only waits for the thumbnails, not for
+     * anything interactive.
+     */
+    QtConcurrent::blockingMap(fileItems, [] (FileItem *file) {
+#ifdef Q_OS_WIN
+        const QString path = QDir::tempPath() + "/" + file->name;
+#else
+        const QString path = QDir::homePath() + "/" + file->name;
+#endif
+
         // get thumbnail -- almost all Krita-supported formats save a thumbnail
         KoStore* store = KoStore::createStore(path, KoStore::Read);
 
@@ -211,13 +234,7 @@ KisAutoSaveRecoveryDialog::KisAutoSaveRecoveryDialog(const QStringList &filename
 
             delete store;
         }
-
-        // get the date
-        QDateTime date = QFileInfo(path).lastModified();
-        file->date = "(" + date.toString(Qt::LocalDate) + ")";
-
-        fileItems.append(file);
-    }
+    });
 
     m_model = new FileItemModel(fileItems, m_listView);
     m_listView->setModel(m_model);
@@ -69,6 +69,7 @@
 #include <QtGlobal>
 #include <QTimer>
 #include <QWidget>
+#include <QtConcurrent>
 #include <QFuture>
 #include <QFutureWatcher>
 #include <QUuid>
@@ -1193,6 +1194,7 @@ void KisDocument::slotInitiateAsyncAutosaving(KisDocument *clonedDocument)
 void KisDocument::slotPerformIdleRoutines()
 {
     d->image->explicitRegenerateLevelOfDetail();
+    d->image->tryWarmUpLodNOnIdle();
 
 
     /// TODO: automatical purging is disabled for now: it modifies
@@ -2350,6 +2352,38 @@ KisImageSP KisDocument::savingImage() const
 }
 
 
+namespace {
+/**
+ * Builds (and thereby caches) the color transformations between the
+ * layer color spaces and the image color space. The first use of a
+ * profile pair makes lcms optimize the transform, which can take
+ * seconds on CMYK proofing setups; doing it here, on a pool thread
+ * right after the document is opened, removes the hitch from the
+ * first brush stroke or merge.
+ */
+void warmColorConversionCache(const KoColorSpace *imageColorSpace,
+                              QList<const KoColorSpace*> layerColorSpaces)
+{
+    Q_FOREACH (const KoColorSpace *colorSpace, layerColorSpaces) {
+        if (*colorSpace == *imageColorSpace) continue;
+
+        QVector<quint8> srcPixel(colorSpace->pixelSize(), 0);
+        QVector<quint8> dstPixel(imageColorSpace->pixelSize(), 0);
+
+        // converting a single pixel is enough to make the cache
+        // create and keep the optimized transforms
+        colorSpace->convertPixelsTo(srcPixel.constData(), dstPixel.data(),
+                                    imageColorSpace, 1,
+                                    KoColorConversionTransformation::internalRenderingIntent(),
+                                    KoColorConversionTransformation::internalConversionFlags());
+        imageColorSpace->convertPixelsTo(dstPixel.constData(), srcPixel.data(),
+                                         colorSpace, 1,
+                                         KoColorConversionTransformation::internalRenderingIntent(),
+                                         KoColorConversionTransformation::internalConversionFlags());
+    }
+}
+}
+
 void KisDocument::setCurrentImage(KisImageSP image, bool forceInitialUpdate)
 {
     if (d->image) {
@@ -2376,6 +2410,26 @@ void KisDocument::setCurrentImage(KisImageSP image, bool forceInitialUpdate)
     if (forceInitialUpdate) {
         d->image->initialRefreshGraph();
     }
+
+    /**
+     * The node tree is walked here, synchronously, because it may be
+     * mutated as soon as the UI is live; only the expensive lcms
+     * transform creation runs on the pool thread. The color space
+     * objects themselves are owned by the registry and never die.
+     */
+    if (const KoColorSpace *imageColorSpace = image->colorSpace()) {
+        QList<const KoColorSpace*> layerColorSpaces;
+        KisLayerUtils::recursiveApplyNodes(image->root(),
+            [&layerColorSpaces] (KisNodeSP node) {
+                const KoColorSpace *colorSpace = node->colorSpace();
+                if (colorSpace && !layerColorSpaces.contains(colorSpace)) {
+                    layerColorSpaces.append(colorSpace);
+                }
+            });
+
+        (void) QtConcurrent::run(warmColorConversionCache,
+                                 imageColorSpace, layerColorSpaces);
+    }
 }
 
 void KisDocument::hackPreliminarySetImage(KisImageSP image)
@@ -16,6 +16,7 @@
 #include <QWidget>
 #include <QVBoxLayout>
 #include <QTime>
+#include <QElapsedTimer>
 #include <QLabel>
 #include <QMouseEvent>
 #include <QDesktopWidget>
@@ -141,6 +142,16 @@ public:
 
     KisSignalCompressor frameRenderStartCompressor;
 
+    /**
+     * Adaptive coalescing of the canvas updates: the base delay
+     * comes from the configured fps limit, but when uploading and
+     * repainting a frame costs more than a frame period, the
+     * compressor window is grown so the GUI thread is never fully
+     * occupied by projection uploads.
+     */
+    int baseFrameRenderDelay = 16;
+    qreal smoothedFrameRenderCost = 0.0;
+
     KisSignalCompressor regionOfInterestUpdateCompressor;
     QRect regionOfInterest;
     qreal regionOfInterestMargin = 0.25;
@@ -200,7 +211,8 @@ KisCanvas2::KisCanvas2(KisCoordinatesConverter *coordConverter, KoCanvasResource
     m_d->canvasUpdateCompressor.setDelay(1000 / config.fpsLimit());
     m_d->canvasUpdateCompressor.setMode(KisSignalCompressor::FIRST_ACTIVE);
 
-    m_d->frameRenderStartCompressor.setDelay(1000 / config.fpsLimit());
+    m_d->baseFrameRenderDelay = 1000 / config.fpsLimit();
+    m_d->frameRenderStartCompressor.setDelay(m_d->baseFrameRenderDelay);
     m_d->frameRenderStartCompressor.setMode(KisSignalCompressor::FIRST_ACTIVE);
     snapGuide()->overrideSnapStrategy(KoSnapGuide::PixelSnapping, new KisSnapPixelStrategy());
 }
@@ -772,6 +784,9 @@ void KisCanvas2::startUpdateCanvasProjection(const QRect & rc)
 
 void KisCanvas2::updateCanvasProjection()
 {
+    QElapsedTimer frameRenderTimer;
+    frameRenderTimer.start();
+
     auto tryIssueCanvasUpdates = [this](const QRect &vRect) {
         if (!m_d->isBatchUpdateActive) {
             // TODO: Implement info->dirtyViewportRect() for KisOpenGLCanvas2 to avoid updating whole canvas
@@ -840,6 +855,25 @@ void KisCanvas2::updateCanvasProjection()
     } else if (shouldExplicitlyIssueUpdates) {
         tryIssueCanvasUpdates(m_d->coordinatesConverter->imageRectInImagePixels());
     }
+
+    /**
+     * Grow the coalescing window when rendering a frame costs more
+     * than the configured frame period, so that during heavy strokes
+     * at most about half of the GUI thread time is spent on
+     * projection uploads; light frames shrink it back towards the
+     * configured fps limit.
+     */
+    const qreal frameCost = frameRenderTimer.nsecsElapsed() / 1000000.0;
+    m_d->smoothedFrameRenderCost =
+        0.8 * m_d->smoothedFrameRenderCost + 0.2 * frameCost;
+
+    const int adaptiveDelay =
+        qBound(m_d->baseFrameRenderDelay,
+               qRound(m_d->smoothedFrameRenderCost * 2.0),
+               200);
+    m_d->frameRenderStartCompressor.setDelay(adaptiveDelay);
+
+    KisStrokeSpeedMonitor::instance()->notifyCanvasUpdated();
 }
 
 void KisCanvas2::slotBeginUpdatesBatch()
@@ -196,7 +196,21 @@ void KisImagePyramid::setImage(KisImageWSP newImage)
             }
 
         }
-        //TODO: check whether there is needed recalculateCache()
+
+        /**
+         * Build the downsampled levels for the initial content as
+         * well: retrieveImageData() only fills the original plane,
+         * and without this the non-original levels stayed empty
+         * until the first dirty update happened to cover the image,
+         * which is why the pyramid used to be disabled.
+         */
+        QRect currentSrcRect = rc;
+        for (int i = FIRST_NOT_ORIGINAL_INDEX; i < m_pyramidHeight; i++) {
+            if (currentSrcRect.isEmpty()) break;
+            currentSrcRect = downsampleByFactor2(currentSrcRect,
+                                                 m_pyramid[i-1].data(),
+                                                 m_pyramid[i].data());
+        }
     }
 }
 
@@ -83,9 +83,14 @@ KisPrescaledProjection::KisPrescaledProjection()
 {
     updateSettings();
 
-    // we disable building the pyramid with setting its height to 1
-    // XXX: setting it higher than 1 is broken because it's not updated until you show/hide the layer
-    m_d->projectionBackend = new KisImagePyramid(1);
+    /**
+     * The pyramid levels are kept warm incrementally: every dirty
+     * rect is downsampled through the levels in recalculateCache()
+     * and the initial content is downsampled on setImage(), so
+     * zooming out on the software canvas blits from the nearest
+     * power-of-two plane instead of rescaling the full projection.
+     */
+    m_d->projectionBackend = new KisImagePyramid(4);
 
     connect(KisConfigNotifier::instance(), SIGNAL(configChanged()), SLOT(updateSettings()));
 }
@@ -1318,25 +1318,32 @@ KisImportExportErrorCode KisPNGConverter::buildFile(QIODevice* iodevice, const Q
     };
 
 
-    // Fill the data structure
-    RowPointersStruct rowPointers(imageRect.size(), device->pixelSize());
+    /**
+     * Streaming path: non-interlaced PNGs (the default) are written
+     * scanline by scanline from a single reused row buffer, so the
+     * export never holds a full-image intermediate - on 16K canvases
+     * the old all-rows buffer doubled the peak memory and pushed
+     * tiles into swap mid-save. Interlaced output keeps the
+     * full-image buffer because Adam7 needs every row in memory for
+     * its multiple passes.
+     */
+    bool fillRowFailed = false;
 
-    int row = 0;
-    for (int y = imageRect.y(); y < imageRect.y() + imageRect.height(); y++, row++) {
+    const auto fillRow = [&] (png_byte *dstRow, int y) {
         KisHLineConstIteratorSP it = device->createHLineConstIteratorNG(imageRect.x(), y, imageRect.width());
 
         switch (color_type) {
         case PNG_COLOR_TYPE_GRAY:
         case PNG_COLOR_TYPE_GRAY_ALPHA:
             if (color_nb_bits == 16) {
-                quint16 *dst = reinterpret_cast<quint16 *>(rowPointers.rows[row]);
+                quint16 *dst = reinterpret_cast<quint16 *>(dstRow);
                 do {
                     const quint16 *d = reinterpret_cast<const quint16 *>(it->oldRawData());
                     *(dst++) = d[0];
                     if (options.alpha) *(dst++) = d[1];
                 } while (it->nextPixel());
             } else {
-                quint8 *dst = rowPointers.rows[row];
+                quint8 *dst = dstRow;
                 do {
                     const quint8 *d = it->oldRawData();
                     *(dst++) = d[0];
@@ -1347,7 +1354,7 @@ KisImportExportErrorCode KisPNGConverter::buildFile(QIODevice* iodevice, const Q
         case PNG_COLOR_TYPE_RGB:
         case PNG_COLOR_TYPE_RGB_ALPHA:
             if (color_nb_bits == 16) {
-                quint16 *dst = reinterpret_cast<quint16 *>(rowPointers.rows[row]);
+                quint16 *dst = reinterpret_cast<quint16 *>(dstRow);
                 do {
                     const quint16 *d = reinterpret_cast<const quint16 *>(it->oldRawData());
                     *(dst++) = d[2];
@@ -1356,7 +1363,7 @@ KisImportExportErrorCode KisPNGConverter::buildFile(QIODevice* iodevice, const Q
                     if (options.alpha) *(dst++) = d[3];
                 } while (it->nextPixel());
             } else {
-                quint8 *dst = rowPointers.rows[row];
+                quint8 *dst = dstRow;
                 do {
                     const quint8 *d = it->oldRawData();
                     *(dst++) = d[2];
@@ -1367,7 +1374,7 @@ KisImportExportErrorCode KisPNGConverter::buildFile(QIODevice* iodevice, const Q
             }
             break;
         case PNG_COLOR_TYPE_PALETTE: {
-            quint8 *dst = rowPointers.rows[row];
+            quint8 *dst = dstRow;
             KisPNGWriteStream writestream(dst, color_nb_bits);
             do {
                 const quint8 *d = it->oldRawData();
@@ -1384,11 +1391,33 @@ KisImportExportErrorCode KisPNGConverter::buildFile(QIODevice* iodevice, const Q
         }
             break;
         default:
-            return ImportExportCodes::FormatColorSpaceUnsupported;
+            fillRowFailed = true;
+            break;
         }
-    }
+    };
+
+    if (!options.interlace) {
+        const int rowBytes = imageRect.width() * device->pixelSize();
+        QScopedArrayPointer<png_byte> rowBuffer(new png_byte[rowBytes]);
+
+        for (int y = imageRect.y(); y < imageRect.y() + imageRect.height(); y++) {
+            fillRow(rowBuffer.data(), y);
+            if (fillRowFailed) return ImportExportCodes::FormatColorSpaceUnsupported;
 
-    png_write_image(png_ptr, rowPointers.rows);
+            png_write_row(png_ptr, rowBuffer.data());
+        }
+    } else {
+        // Fill the data structure
+        RowPointersStruct rowPointers(imageRect.size(), device->pixelSize());
+
+        int row = 0;
+        for (int y = imageRect.y(); y < imageRect.y() + imageRect.height(); y++, row++) {
+            fillRow(rowPointers.rows[row], y);
+            if (fillRowFailed) return ImportExportCodes::FormatColorSpaceUnsupported;
+        }
+
+        png_write_image(png_ptr, rowPointers.rows);
+    }
 
     // Writing is over
     png_write_end(png_ptr, info_ptr);
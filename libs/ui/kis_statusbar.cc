@@ -308,8 +308,9 @@ void KisStatusBar::updateMemoryStatus()
                   "  image data:\t %3 / %4\n"
                   "  pool:\t\t %5 / %6\n"
                   "  undo data:\t %7\n"
+                  "  shared by clones:\t %8\n"
                   "\n"
-                  "Swap used:\t %8",
+                  "Swap used:\t %9",
                   format.formatByteSize(stats.totalMemorySize),
                   format.formatByteSize(stats.totalMemoryLimit),
 
@@ -320,6 +321,7 @@ void KisStatusBar::updateMemoryStatus()
                   format.formatByteSize(stats.tilesPoolLimit),
 
                   format.formatByteSize(stats.historicalMemorySize),
+                  format.formatByteSize(stats.sharedMemorySize),
                   format.formatByteSize(stats.swapSize));
 
     QString longStats = imageStatsMsg + "\n" + memoryStatsMsg;
@@ -5,6 +5,8 @@
  */
 #include "KisOpenGLUpdateInfoBuilder.h"
 
+#include <QtConcurrent>
+
 // TODO: conversion options into a separate file!
 #include "kis_update_info.h"
 #include "opengl/kis_texture_tile_info_pool.h"
@@ -139,16 +141,6 @@ KisOpenGLUpdateInfoSP KisOpenGLUpdateInfoBuilder::buildUpdateInfo(const QRect &r
                                                      m_d->pool));
             // Don't update empty tiles
             if (tileInfo->valid()) {
-                tileInfo->retrieveData(projection, channelFlags, m_d->onlyOneChannelSelected, m_d->selectedChannelIndex);
-
-                if (convertColorSpace) {
-                    if (m_d->proofingTransform) {
-                        tileInfo->proofTo(m_d->conversionOptions.m_destinationColorSpace, m_d->proofingConfig->conversionFlags, m_d->proofingTransform.data());
-                    } else {
-                        tileInfo->convertTo(m_d->conversionOptions.m_destinationColorSpace, m_d->conversionOptions.m_renderingIntent, m_d->conversionOptions.m_conversionFlags);
-                    }
-                }
-
                 info->tileList.append(tileInfo);
             }
             else {
@@ -157,6 +149,42 @@ KisOpenGLUpdateInfoSP KisOpenGLUpdateInfoBuilder::buildUpdateInfo(const QRect &r
         }
     }
 
+    /**
+     * Fetching and converting the tiles is independent per tile, and
+     * on deep (10-bit/OCIO) display pipelines the color conversion
+     * dominates the whole canvas update, so run it on the global
+     * pool when there is more than one tile. The projection is only
+     * read and the tile info pool is thread-safe. Soft proofing
+     * keeps the serial path: all tiles share one lcms proofing
+     * transform object, and unlike the plain converters it is not
+     * guaranteed stateless.
+     */
+    const auto processTile = [&] (KisTextureTileUpdateInfoSP tileInfo) {
+        tileInfo->retrieveData(projection, channelFlags, m_d->onlyOneChannelSelected, m_d->selectedChannelIndex);
+
+        if (convertColorSpace) {
+            tileInfo->convertTo(m_d->conversionOptions.m_destinationColorSpace, m_d->conversionOptions.m_renderingIntent, m_d->conversionOptions.m_conversionFlags);
+        }
+    };
+
+    const bool useProofing = convertColorSpace && m_d->proofingTransform;
+
+    if (!useProofing && info->tileList.size() > 1) {
+        QtConcurrent::blockingMap(info->tileList, processTile);
+    } else {
+        Q_FOREACH (KisTextureTileUpdateInfoSP tileInfo, info->tileList) {
+            tileInfo->retrieveData(projection, channelFlags, m_d->onlyOneChannelSelected, m_d->selectedChannelIndex);
+
+            if (convertColorSpace) {
+                if (m_d->proofingTransform) {
+                    tileInfo->proofTo(m_d->conversionOptions.m_destinationColorSpace, m_d->proofingConfig->conversionFlags, m_d->proofingTransform.data());
+                } else {
+                    tileInfo->convertTo(m_d->conversionOptions.m_destinationColorSpace, m_d->conversionOptions.m_renderingIntent, m_d->conversionOptions.m_conversionFlags);
+                }
+            }
+        }
+    }
+
     info->assignDirtyImageRect(rect);
     info->assignLevelOfDetail(levelOfDetail);
     return info;
@@ -9,6 +9,7 @@
 
 #include "opengl/kis_opengl_canvas2.h"
 #include "opengl/kis_opengl_canvas2_p.h"
+#include "KisChromeTraceRecorder.h"
 
 #include "kis_algebra_2d.h"
 #include "opengl/kis_opengl_shader_loader.h"
@@ -1154,6 +1155,8 @@ QRect KisOpenGLCanvas2::updateCanvasProjection(KisUpdateInfoSP info)
 
 QVector<QRect> KisOpenGLCanvas2::updateCanvasProjection(const QVector<KisUpdateInfoSP> &infoObjects)
 {
+    KIS_TRACE_SCOPE("gl texture upload");
+
 #if defined(Q_OS_MACOS) || defined(Q_OS_ANDROID)
     /**
      * On OSX openGL different (shared) contexts have different execution queues.
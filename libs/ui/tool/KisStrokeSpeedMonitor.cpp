@@ -9,6 +9,9 @@
 #include <QGlobalStatic>
 #include <QMutex>
 #include <QMutexLocker>
+#include <QElapsedTimer>
+#include <QVector>
+#include <algorithm>
 
 #include <KisRollingMeanAccumulatorWrapper.h>
 #include "kis_paintop_preset.h"
@@ -52,12 +55,17 @@ struct KisStrokeSpeedMonitor::Private
 
     bool haveStrokeSpeedMeasurement = true;
 
+    QElapsedTimer latencyTimer;
+    qint64 lastInputEventTime = -1;
+    QVector<int> strokeLatencies;
+
     QMutex mutex;
 };
 
 KisStrokeSpeedMonitor::KisStrokeSpeedMonitor()
     : m_d(new Private())
 {
+    m_d->latencyTimer.start();
     connect(KisImageConfigNotifier::instance(), SIGNAL(configChanged()), SLOT(resetAccumulatedValues()));
     connect(KisImageConfigNotifier::instance(), SIGNAL(configChanged()), SIGNAL(sigStatsUpdated()));
     connect(KisConfigNotifier::instance(), SIGNAL(configChanged()), SLOT(slotConfigChanged()));
@@ -99,8 +107,59 @@ void KisStrokeSpeedMonitor::slotConfigChanged()
     emit sigStatsUpdated();
 }
 
+void KisStrokeSpeedMonitor::notifyInputEventProcessed()
+{
+    if (!m_d->haveStrokeSpeedMeasurement) return;
+
+    QMutexLocker locker(&m_d->mutex);
+    m_d->lastInputEventTime = m_d->latencyTimer.elapsed();
+}
+
+void KisStrokeSpeedMonitor::notifyCanvasUpdated()
+{
+    if (!m_d->haveStrokeSpeedMeasurement) return;
+
+    QMutexLocker locker(&m_d->mutex);
+
+    if (m_d->lastInputEventTime < 0) return;
+
+    // bound the per-stroke sample storage: long airbrush strokes
+    // should not grow it indefinitely
+    static const int maxSamples = 10000;
+
+    if (m_d->strokeLatencies.size() < maxSamples) {
+        m_d->strokeLatencies.append(
+            int(m_d->latencyTimer.elapsed() - m_d->lastInputEventTime));
+    }
+
+    m_d->lastInputEventTime = -1;
+}
+
 void KisStrokeSpeedMonitor::notifyStrokeFinished(qreal cursorSpeed, qreal renderingSpeed, qreal fps, KisPaintOpPresetSP preset)
 {
+    if (m_d->haveStrokeSpeedMeasurement && !m_d->strokeLatencies.isEmpty()) {
+        QVector<int> latencies;
+
+        {
+            QMutexLocker locker(&m_d->mutex);
+            latencies = m_d->strokeLatencies;
+            m_d->strokeLatencies.clear();
+            m_d->lastInputEventTime = -1;
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+
+        const int p50 = latencies[latencies.size() / 2];
+        const int p90 = latencies[latencies.size() * 9 / 10];
+        const int pMax = latencies.last();
+
+        qInfo() << "Stroke event-to-canvas latency (ms):"
+                << "p50" << p50
+                << "p90" << p90
+                << "max" << pMax
+                << "samples" << latencies.size();
+    }
+
     if (qFuzzyCompare(cursorSpeed, 0.0) || qFuzzyCompare(renderingSpeed, 0.0)) return;
 
     QMutexLocker locker(&m_d->mutex);
@@ -39,6 +39,17 @@ public:
 
     void notifyStrokeFinished(qreal cursorSpeed, qreal renderingSpeed, qreal fps, KisPaintOpPresetSP preset);
 
+    /**
+     * Opt-in end-to-end latency instrumentation (gated by the same
+     * switch as the speed measurement): the freehand tool stamps
+     * every processed input event and the canvas reports when the
+     * projection reached the widget; the percentiles of the
+     * event-to-canvas latency are logged when the stroke finishes.
+     * Both entry points must be called from the GUI thread.
+     */
+    void notifyInputEventProcessed();
+    void notifyCanvasUpdated();
+
 
     QString lastPresetName() const;
     qreal lastPresetSize() const;
@@ -10,6 +10,8 @@
  */
 
 #include "kis_tool_freehand.h"
+
+#include "KisStrokeSpeedMonitor.h"
 #include <QPainter>
 #include <QRect>
 #include <QThreadPool>
@@ -225,6 +227,8 @@ void KisToolFreehand::continuePrimaryAction(KoPointerEvent *event)
      * Actual painting
      */
     doStroke(event);
+
+    KisStrokeSpeedMonitor::instance()->notifyInputEventProcessed();
 }
 
 void KisToolFreehand::endPrimaryAction(KoPointerEvent *event)
@@ -8,6 +8,7 @@
 
 #include <QThread>
 #include <QVector>
+#include <QtConcurrent>
 #include <limits>
 #include <algorithm>
 #include <QTime>
@@ -148,33 +149,69 @@ void HistogramComputationThread::run()
     quint32 imageSize = m_bounds.width() * m_bounds.height();
     quint32 nSkip = 1 + (imageSize >> 20); //for speed use about 1M pixels for computing histograms
 
+    const int numBins = std::numeric_limits<quint8>::max() + 1;
+
     //allocate space for the histogram data
     bins.resize((int)channelCount);
     for (auto &bin : bins) {
-        bin.resize(std::numeric_limits<quint8>::max() + 1);
+        bin.resize(numBins);
     }
 
     QRect bounds = m_dev->exactBounds();
     if (bounds.isEmpty())
         return;
 
-    quint32 toSkip = nSkip;
+    /**
+     * Split the device into tile-aligned strips, accumulate partial
+     * bins per strip on the global thread pool and merge them at the
+     * end; the paint device is only read, so the concurrent
+     * iterators are safe.
+     */
+    const int idealNumThreads = qMax(1, QThread::idealThreadCount());
+    const qint32 tileAlignment = 64;
+    qint32 stripHeight = (bounds.height() + idealNumThreads - 1) / idealNumThreads;
+    stripHeight = qMax(tileAlignment, (stripHeight + tileAlignment - 1) & ~(tileAlignment - 1));
+
+    QVector<QRect> strips;
+    for (qint32 y = bounds.top(); y <= bounds.bottom(); y += stripHeight) {
+        strips.append(QRect(bounds.left(), y,
+                            bounds.width(),
+                            qMin(stripHeight, bounds.bottom() - y + 1)));
+    }
+
+    const auto computeStrip = [&] (const QRect &strip) {
+        HistVector stripBins((int)channelCount, std::vector<quint32>(numBins));
 
-    KisSequentialConstIterator it(m_dev, m_dev->exactBounds());
+        quint32 toSkip = nSkip;
+        KisSequentialConstIterator it(m_dev, strip);
 
-    int numConseqPixels = it.nConseqPixels();
-    while (it.nextPixels(numConseqPixels)) {
+        int numConseqPixels = it.nConseqPixels();
+        while (it.nextPixels(numConseqPixels)) {
 
-        numConseqPixels = it.nConseqPixels();
-        const quint8* pixel = it.rawDataConst();
-        for (int k = 0; k < numConseqPixels; ++k) {
-            if (--toSkip == 0) {
-                for (int chan = 0; chan < (int)channelCount; ++chan) {
-                    bins[chan][cs->scaleToU8(pixel, chan)]++;
+            numConseqPixels = it.nConseqPixels();
+            const quint8* pixel = it.rawDataConst();
+            for (int k = 0; k < numConseqPixels; ++k) {
+                if (--toSkip == 0) {
+                    for (int chan = 0; chan < (int)channelCount; ++chan) {
+                        stripBins[chan][cs->scaleToU8(pixel, chan)]++;
+                    }
+                    toSkip = nSkip;
                 }
-                toSkip = nSkip;
+                pixel += pixelSize;
+            }
+        }
+
+        return stripBins;
+    };
+
+    const QVector<HistVector> partialBins =
+        QtConcurrent::blockingMapped(strips, computeStrip);
+
+    Q_FOREACH (const HistVector &partial, partialBins) {
+        for (int chan = 0; chan < (int)channelCount; ++chan) {
+            for (int i = 0; i < numBins; ++i) {
+                bins[chan][i] += partial[chan][i];
             }
-            pixel += pixelSize;
         }
     }
 
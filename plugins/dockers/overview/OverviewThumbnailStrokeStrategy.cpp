@@ -45,6 +45,10 @@ OverviewThumbnailStrokeStrategy::OverviewThumbnailStrokeStrategy(KisPaintDeviceS
     setRequestsOtherStrokesToEnd(false);
     setClearsRedoOnStart(false);
     setCanForgetAboutMe(true);
+
+    // background work: freshly started interactive strokes may jump
+    // ahead of a queued thumbnail regeneration
+    setPriority(100);
 }
 
 OverviewThumbnailStrokeStrategy::~OverviewThumbnailStrokeStrategy()
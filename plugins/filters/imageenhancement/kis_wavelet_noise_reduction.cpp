@@ -20,6 +20,7 @@
 #include <filter/kis_filter_category_ids.h>
 #include <filter/kis_filter_configuration.h>
 #include <kis_processing_information.h>
+#include <QtConcurrent>
 #include "kis_global.h"
 
 KisWaveletNoiseReduction::KisWaveletNoiseReduction()
@@ -91,21 +92,37 @@ void KisWaveletNoiseReduction::processImpl(KisPaintDeviceSP device,
 
     progressUpdater->setRange(0, numProgressSteps);
 
-    for (float* it = begin; it < fin; it++) {
-        if (*it > threshold) {
-            *it -= threshold;
-        } else if (*it < -threshold) {
-            *it += threshold;
-        } else {
-            *it = 0.;
-        }
-
-        if (!(pointsProcessed & progressMask)) {
-            progressUpdater->setValue(pointsProcessed >> progressOffset);
-        }
-        pointsProcessed++;
+    /**
+     * The soft-shrink of the wavelet coefficients is elementwise and
+     * makes up a good share of the filter's runtime on big planes,
+     * so run it chunk-parallel; the branchless form also lets the
+     * compiler vectorize the inner loop. The progress updater only
+     * learns about whole chunks, which is plenty for a pass this
+     * fast.
+     */
+    Q_UNUSED(progressMask);
+    Q_UNUSED(pointsProcessed);
+
+    static const int chunkSize = 1 << 16;
+    QVector<int> chunkOffsets;
+    for (int offset = 0; offset < size; offset += chunkSize) {
+        chunkOffsets.append(offset);
     }
 
+    QtConcurrent::blockingMap(chunkOffsets,
+        [begin, fin, threshold] (int offset) {
+            float *it = begin + offset;
+            float *end = qMin(it + chunkSize, fin);
+
+            for (; it < end; it++) {
+                const float value = *it;
+                const float shrunk = qMax(0.0f, qAbs(value) - threshold);
+                *it = value < 0 ? -shrunk : shrunk;
+            }
+        });
+
+    progressUpdater->setValue(numProgressSteps);
+
     mathToolbox.fastWaveletUntransformation(device, applyRect, wav, buff);
 
     delete wav;
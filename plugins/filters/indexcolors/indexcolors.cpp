@@ -13,6 +13,7 @@
 #include <KoColorSpaceRegistry.h>
 #include <filter/kis_filter_category_ids.h>
 #include <filter/kis_color_transformation_configuration.h>
+#include <QVarLengthArray>
 #include <widgets/kis_multi_integer_filter_widget.h>
 
 #include "kiswdgindexcolors.h"
@@ -106,24 +107,34 @@ KisIndexColorTransformation::KisIndexColorTransformation(IndexColorPalette palet
 
 void KisIndexColorTransformation::transform(const quint8* src, quint8* dst, qint32 nPixels) const
 {
-    union
+    union LabPixel
     {
         quint16 laba[4];
         LabColor lab;
-    } clr;
-    while (nPixels--)
-    {
-        m_colorSpace->toLabA16(src, reinterpret_cast<quint8 *>(clr.laba), 1);
+    };
+
+    /**
+     * Convert the whole span to Lab in one call instead of paying
+     * the per-pixel transform overhead (the palette search itself is
+     * cheap next to one lcms invocation per pixel), quantize in
+     * place, and convert back in one call.
+     */
+    QVarLengthArray<LabPixel, 1024> labBuffer(nPixels);
+
+    m_colorSpace->toLabA16(src, reinterpret_cast<quint8 *>(labBuffer.data()), nPixels);
+
+    for (qint32 i = 0; i < nPixels; i++) {
+        LabPixel &clr = labBuffer[i];
+
         clr.lab = m_palette.getNearestIndex(clr.lab);
         if(m_alphaStep)
         {
             quint16 amod = clr.laba[3] % m_alphaStep;
             clr.laba[3] = clr.laba[3] + (amod > m_alphaHalfStep ? m_alphaStep - amod : -amod);
         }
-        m_colorSpace->fromLabA16(reinterpret_cast<quint8 *>(clr.laba), dst, 1);
-        src += m_psize;
-        dst += m_psize;
     }
+
+    m_colorSpace->fromLabA16(reinterpret_cast<const quint8 *>(labBuffer.constData()), dst, nPixels);
 }
 
 #include "indexcolors.moc"
@@ -7,6 +7,7 @@
  */
 
 #include "KisScreentoneScreentoneFunctions.h"
+#include <QVector>
 
 #include <cmath>
 
@@ -61,8 +62,31 @@ namespace KisScreentoneScreentoneFunctions {
 
 qreal sin(qreal x)
 {
-    x = std::cos(x * M_PI);
-    return  x * x;
+    /**
+     * cos^2(pi*x) has period 1, so serve it from a one-period LUT
+     * with linear interpolation; at 8192 samples the interpolation
+     * error is ~1e-7, far below the 8/16-bit quantization of the
+     * generated tones, and the per-pixel cost drops from a libm
+     * cosine to two loads and a lerp. This function sits under
+     * every dot/line/ellipse screentone shape.
+     */
+    static constexpr int lutSize = 8192;
+    static const QVector<qreal> lut = [] () {
+        QVector<qreal> table(lutSize + 1);
+        for (int i = 0; i <= lutSize; i++) {
+            const qreal value = std::cos(M_PI * qreal(i) / lutSize);
+            table[i] = value * value;
+        }
+        return table;
+    }();
+
+    x = x - std::floor(x);
+
+    const qreal position = x * lutSize;
+    const int index = static_cast<int>(position);
+    const qreal fraction = position - index;
+
+    return lut[index] + fraction * (lut[index + 1] - lut[index]);
 }
 
 qreal triangle(qreal x)
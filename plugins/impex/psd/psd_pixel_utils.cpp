@@ -6,6 +6,9 @@
 
 #include "psd_pixel_utils.h"
 
+#include <QtConcurrent>
+#include <numeric>
+
 #include <QtGlobal>
 #include <QMap>
 #include <QIODevice>
@@ -565,10 +568,26 @@ void writeChannelDataRLE(QIODevice *io, const quint8 *plane, const int channelSi
     }
 
     quint32 stride = channelSize * rc.width();
-    for (qint32 row = 0; row < rc.height(); ++row) {
 
-        QByteArray uncompressed = QByteArray::fromRawData((const char*)plane + row * stride, stride);
-        QByteArray compressed = Compression::compress(uncompressed, Compression::RLE);
+    /**
+     * The RLE packing of the rows is independent per row and
+     * dominates export time on layered files, so compress all the
+     * rows of the channel on the pool and then write them out
+     * strictly in order - the file layout is identical to the
+     * serial writer's.
+     */
+    QVector<qint32> rows(rc.height());
+    std::iota(rows.begin(), rows.end(), 0);
+
+    const QVector<QByteArray> compressedRows =
+        QtConcurrent::blockingMapped(rows, [plane, stride] (qint32 row) {
+            const QByteArray uncompressed =
+                QByteArray::fromRawData((const char*)plane + row * stride, stride);
+            return Compression::compress(uncompressed, Compression::RLE);
+        });
+
+    for (qint32 row = 0; row < rc.height(); ++row) {
+        const QByteArray &compressed = compressedRows[row];
 
         KisAslWriterUtils::OffsetStreamPusher<quint16> rleExternalTag(io, 0, channelRLESizePos + row * sizeof(quint16));
 
@@ -67,81 +67,49 @@ void KisSmudgeRadiusOption::apply(KoColor *resultColor,
         const KoColorSpace* cs = dev->colorSpace();
         const int pixelSize = cs->pixelSize();
 
-        quint8* data = new quint8[pixelSize];
-        quint8* pixels[2];
-        qint16 weights[2];
-
-        pixels[1] = new quint8[pixelSize];
-        pixels[0] = new quint8[pixelSize];
-
         int loop_increment = 1;
         if(smudgeRadius >= 8)
         {
             loop_increment = (2*smudgeRadius)/16;
         }
-        int i = 0;
-        int k = 0;
-        int j = 0;
+
+        /**
+         * Gather all the sample pixels into one contiguous buffer
+         * and average them with a single mixColors() call. The old
+         * code mixed every sample into a running two-color blend,
+         * which paid a full mixColorsOp() invocation per sample and
+         * accumulated rounding with every step; the one-shot uniform
+         * average is both much cheaper on big radii and numerically
+         * stable. The sample grid (including the duplicated axis
+         * samples of the sign-flip loops) is unchanged.
+         */
+        QVector<quint8> samples;
+        int sampleCount = 0;
 
         KisRandomConstAccessorSP accessor = dev->createRandomConstAccessorNG();
-        accessor->moveTo(posx, posy);
-        memcpy(color.data(), accessor->rawDataConst(), pixelSize);
 
         for (int y = 0; y <= smudgeRadius; y = y + loop_increment) {
             for (int x = 0; x <= smudgeRadius; x = x + loop_increment) {
+                for (int j = 0; j < 2; j++) {
+                    const int sampleY = j ? -y : y;
 
-                for(j = 0;j < 2;j++)
-                {
-                    if(j == 1)
-                    {
-                        y = y*(-1);
-                    }
-                    for(k = 0;k < 2;k++)
-                    {
-                        if(k == 1)
-                        {
-                            x = x*(-1);
-                        }
-                        accessor->moveTo(posx + x, posy + y);
-                        memcpy(pixels[1], accessor->rawDataConst(), pixelSize);
-                        if(i == 0)
-                        {
-                            memcpy(pixels[0],accessor->rawDataConst(),pixelSize);
-                        }
-                        if (x == 0 && y == 0) {
-                            // Because the sum of the weights must be 255,
-                            // we cheat a bit, and weigh the center pixel differently in order
-                            // to sum to 255 in total
-                            // It's -(counts -1), because we'll add the center one implicitly
-                            // through that calculation
-                            weights[1] = (255 - ((i + 1) * (255 /(i+2) )) );
-                        } else {
-                            weights[1] = 255 /(i+2);
-                        }
-
-
-                        i++;
-                        if (i>smudgeRadius){i=0;}
-                        weights[0] = 255 - weights[1];
-                        const quint8** cpixels = const_cast<const quint8**>(pixels);
-                        cs->mixColorsOp()->mixColors(cpixels, weights,2, data);
-                        memcpy(pixels[0],data,pixelSize);
+                    for (int k = 0; k < 2; k++) {
+                        const int sampleX = k ? -x : x;
 
+                        accessor->moveTo(posx + sampleX, posy + sampleY);
 
+                        samples.resize((sampleCount + 1) * pixelSize);
+                        memcpy(samples.data() + sampleCount * pixelSize,
+                               accessor->rawDataConst(), pixelSize);
+                        sampleCount++;
                     }
-                    x = x*(-1);
                 }
-                y = y*(-1);
             }
-
         }
 
-        color = KoColor(pixels[0],cs);
-
-        for (int l = 0; l < 2; l++){
-            delete[] pixels[l];
+        if (sampleCount > 0) {
+            cs->mixColorsOp()->mixColors(samples.constData(), sampleCount, color.data());
         }
-        delete[] data;
     }
 
     *resultColor = color.convertedTo(resultColor->colorSpace());
@@ -156,6 +156,18 @@ void HairyBrush::paintLine(KisPaintDeviceSP dab, KisPaintDeviceSP layer, const K
     int bristleCount = m_bristles.size();
     int bristlePathSize;
     qreal threshold = 1.0 - pi2.pressure();
+    /**
+     * The rotation and scale are the same for every bristle of the
+     * dab; only the random jitter translation differs. Composing the
+     * invariant part once saves a sincos per bristle on 500+ bristle
+     * presets.
+     */
+    shear = pressure * m_properties->shearFactor;
+
+    QTransform baseTransform;
+    baseTransform.rotateRadians(-angle);
+    baseTransform.scale(scale, scale);
+
     for (int i = 0; i < bristleCount; i++) {
 
         if (!m_bristles.at(i)->enabled()) continue;
@@ -164,11 +176,7 @@ void HairyBrush::paintLine(KisPaintDeviceSP dab, KisPaintDeviceSP layer, const K
         randomX = (randomSource->generateNormalized() * 2 - 1.0) * m_properties->randomFactor;
         randomY = (randomSource->generateNormalized() * 2 - 1.0) * m_properties->randomFactor;
 
-        shear = pressure * m_properties->shearFactor;
-
-        m_transform.reset();
-        m_transform.rotateRadians(-angle);
-        m_transform.scale(scale, scale);
+        m_transform = baseTransform;
         m_transform.translate(randomX, randomY);
         m_transform.shear(shear, shear);
 
@@ -206,9 +214,21 @@ void HairyBrush::paintLine(KisPaintDeviceSP dab, KisPaintDeviceSP layer, const K
         }
 
         memcpy(bristleColor.data(), bristle->color().data() , m_pixelSize);
-        for (int i = 0; i < bristlePathSize ; i++) {
 
-            if (m_properties->inkDepletionEnabled) {
+        if (!m_properties->inkDepletionEnabled) {
+            // without depletion the color is invariant along the
+            // path, so set the opacity once instead of per point
+            if (bristleColor.opacityU8() != 0) {
+                bristleColor.setOpacity(bristle->length());
+            }
+
+            for (int i = 0; i < bristlePathSize ; i++) {
+                addBristleInk(bristle, bristlePath.at(i), bristleColor);
+                bristle->setInkAmount(1.0);
+                bristle->upIncrement();
+            }
+        } else {
+            for (int i = 0; i < bristlePathSize ; i++) {
                 inkDeplation = fetchInkDepletion(bristle, inkDepletionSize);
 
                 if (m_properties->useSaturation && m_transfo != 0) {
@@ -219,16 +239,10 @@ void HairyBrush::paintLine(KisPaintDeviceSP dab, KisPaintDeviceSP layer, const K
                     opacityDepletion(bristle, bristleColor, pressure, inkDeplation);
                 }
 
+                addBristleInk(bristle, bristlePath.at(i), bristleColor);
+                bristle->setInkAmount(1.0 - inkDeplation);
+                bristle->upIncrement();
             }
-            else {
-                if (bristleColor.opacityU8() != 0) {
-                    bristleColor.setOpacity(bristle->length());
-                }
-            }
-
-            addBristleInk(bristle, bristlePath.at(i), bristleColor);
-            bristle->setInkAmount(1.0 - inkDeplation);
-            bristle->upIncrement();
         }
 
     }
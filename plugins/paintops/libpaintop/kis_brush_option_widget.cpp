@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: LGPL-2.0-or-later
  */
 #include "kis_brush_option_widget.h"
+
+#include <QtConcurrent>
 #include <klocalizedstring.h>
 
 #include <kis_image.h>
@@ -76,6 +78,19 @@ void KisBrushOptionWidget::readOptionSetting(const KisPropertiesConfigurationSP
     m_brushSelectionWidget->readOptionSetting(setting);
     m_brushOption.readOptionSetting(setting, resourcesInterface(), canvasResourcesInterface());
     m_brushSelectionWidget->setCurrentBrush(m_brushOption.brush());
+
+    /**
+     * Pre-bake the brush tip pyramid on a pool thread, so the first
+     * dab after switching to this preset doesn't pay for it. The
+     * pyramid build is lazy and thread-safe; the captured shared
+     * pointer keeps the brush alive for the duration of the task.
+     */
+    KisBrushSP brushTip = m_brushOption.brush();
+    if (brushTip) {
+        (void) QtConcurrent::run([brushTip] () {
+            brushTip->preWarmBrushPyramid();
+        });
+    }
 }
 
 void KisBrushOptionWidget::lodLimitations(KisPaintopLodLimitations *l) const
@@ -16,6 +16,112 @@
 
 #include <kundo2command.h>
 
+#include <QMutex>
+#include <QMutexLocker>
+
+namespace {
+
+/**
+ * A small cross-stroke cache of generated dabs. The per-stroke cache
+ * above only remembers the immediately preceding dab, so stamp-style
+ * strokes with jitter disabled regenerated thousands of identical
+ * masks per session. Keyed by the brush object (a strong reference,
+ * so the pointer can never be reused while the entry lives) plus the
+ * exact generation parameters; holds the pre-postprocessing dab.
+ */
+struct GlobalDabCache
+{
+    struct Entry {
+        KisBrushSP brush;
+        KisDabCacheBase::SavedDabParameters params;
+        KisFixedPaintDeviceSP dab;
+        qint64 byteSize = 0;
+    };
+
+    static GlobalDabCache* instance() {
+        static GlobalDabCache cache;
+        return &cache;
+    }
+
+    KisFixedPaintDeviceSP fetch(KisBrushSP brush,
+                                const KisDabCacheBase::SavedDabParameters &params,
+                                const KoColorSpace *colorSpace)
+    {
+        QMutexLocker locker(&m_mutex);
+
+        for (int i = 0; i < m_entries.size(); i++) {
+            const Entry &entry = m_entries[i];
+
+            if (entry.brush == brush &&
+                entry.params.equalsExactly(params) &&
+                *entry.dab->colorSpace() == *colorSpace) {
+
+                if (i > 0) {
+                    m_entries.move(i, 0);
+                }
+
+                m_numHits++;
+                return m_entries.first().dab;
+            }
+        }
+
+        m_numMisses++;
+        return KisFixedPaintDeviceSP();
+    }
+
+    void store(KisBrushSP brush,
+               const KisDabCacheBase::SavedDabParameters &params,
+               KisFixedPaintDeviceSP dab)
+    {
+        /**
+         * Pressure-driven size/opacity makes every dab a unique key,
+         * so the ordinary stroke path must not pay a deep dab copy
+         * per dab, and the retained set must not pin memory outside
+         * the image budgets. Small dabs (the stamp-style case the
+         * cache exists for) are cheap to copy and bounded by the
+         * total byte budget below; anything bigger is not cached at
+         * all.
+         */
+        static const int maxEntries = 8;
+        static const qint64 maxDabBytes = 256 * 1024;
+        static const qint64 maxTotalBytes = 2 * 1024 * 1024;
+
+        const qint64 dabBytes =
+            qint64(dab->bounds().width()) * dab->bounds().height() * dab->pixelSize();
+
+        if (dabBytes > maxDabBytes) return;
+
+        QMutexLocker locker(&m_mutex);
+
+        Entry entry;
+        entry.brush = brush;
+        entry.params = params;
+        entry.dab = new KisFixedPaintDevice(*dab);
+        entry.byteSize = dabBytes;
+
+        m_entries.prepend(entry);
+        m_totalBytes += dabBytes;
+
+        while (m_entries.size() > maxEntries || m_totalBytes > maxTotalBytes) {
+            m_totalBytes -= m_entries.last().byteSize;
+            m_entries.removeLast();
+        }
+    }
+
+    // instrumentation, visible in the debugger and usable by tests
+    int numHits() const { return m_numHits; }
+    int numMisses() const { return m_numMisses; }
+
+private:
+    QMutex m_mutex;
+    QList<Entry> m_entries;
+    qint64 m_totalBytes = 0;
+    int m_numHits = 0;
+    int m_numMisses = 0;
+};
+
+}
+
 struct KisDabCache::Private {
 
     Private(KisBrushSP brush)
@@ -197,10 +303,54 @@ KisFixedPaintDeviceSP KisDabCache::fetchDabCommon(const KoColorSpace *cs,
         return fetchFromCache(&resources, info, dstDabRect);
     }
 
+    // 2.5. Try the cross-stroke dab cache: the same brush tip with
+    //      the same parameters produces the same dab regardless of
+    //      the stroke it belongs to
+
+    const bool globallyCacheable =
+        di.solidColorFill && m_d->brush->supportsCaching();
+
+    SavedDabParameters globalKey;
+
+    if (globallyCacheable) {
+        globalKey = getDabParameters(m_d->brush,
+                                     di.paintColor,
+                                     di.shape,
+                                     di.info,
+                                     di.subPixel.x(),
+                                     di.subPixel.y(),
+                                     di.softnessFactor,
+                                     di.lightnessStrength,
+                                     di.mirrorProperties);
+
+        KisFixedPaintDeviceSP cachedDab =
+            GlobalDabCache::instance()->fetch(m_d->brush, globalKey, cs);
+
+        if (cachedDab) {
+            *m_d->dab = *cachedDab;
+
+            if (di.needsPostprocessing) {
+                if (!m_d->dabOriginal || *cs != *m_d->dabOriginal->colorSpace()) {
+                    m_d->dabOriginal = new KisFixedPaintDevice(cs);
+                }
+
+                *m_d->dabOriginal = *m_d->dab;
+
+                postProcessDab(m_d->dab, di.dstDabRect.topLeft(), info, &resources);
+            }
+
+            return m_d->dab;
+        }
+    }
+
     // 3. Generate new dab
 
     generateDab(di, &resources, &m_d->dab);
 
+    if (globallyCacheable) {
+        GlobalDabCache::instance()->store(m_d->brush, globalKey, m_d->dab);
+    }
+
     // 4. Do postprocessing
     if (di.needsPostprocessing) {
         if (!m_d->dabOriginal || *cs != *m_d->dabOriginal->colorSpace()) {
@@ -37,36 +37,39 @@ static const PrecisionValues precisionLevels[] = {
     {       eps,    0, eps,  eps, eps, eps}
 };
 
-struct KisDabCacheBase::SavedDabParameters {
-    KoColor color;
-    qreal angle;
-    int width;
-    int height;
-    qreal subPixelX;
-    qreal subPixelY;
-    qreal softnessFactor;
-    qreal lightnessStrength;
-    qreal ratio;
-    int index;
-    MirrorProperties mirrorProperties;
-
-    bool compare(const SavedDabParameters &rhs, int precisionLevel) const {
-        const PrecisionValues &prec = precisionLevels[precisionLevel];
-
-        return color == rhs.color &&
-               qAbs(angle - rhs.angle) <= prec.angle &&
-               qAbs(width - rhs.width) <= (int)(prec.sizeFrac * width) &&
-               qAbs(height - rhs.height) <= (int)(prec.sizeFrac * height) &&
-               qAbs(subPixelX - rhs.subPixelX) <= prec.subPixel &&
-               qAbs(subPixelY - rhs.subPixelY) <= prec.subPixel &&
-               qAbs(softnessFactor - rhs.softnessFactor) <= prec.softnessFactor &&
-               qAbs(lightnessStrength - rhs.lightnessStrength) <= prec.lightnessStrength &&
-               qAbs(ratio - rhs.ratio) <= prec.ratio &&
-               index == rhs.index &&
-               mirrorProperties.horizontalMirror == rhs.mirrorProperties.horizontalMirror &&
-               mirrorProperties.verticalMirror == rhs.mirrorProperties.verticalMirror;
-    }
-};
+bool KisDabCacheBase::SavedDabParameters::compare(const SavedDabParameters &rhs, int precisionLevel) const
+{
+    const PrecisionValues &prec = precisionLevels[precisionLevel];
+
+    return color == rhs.color &&
+           qAbs(angle - rhs.angle) <= prec.angle &&
+           qAbs(width - rhs.width) <= (int)(prec.sizeFrac * width) &&
+           qAbs(height - rhs.height) <= (int)(prec.sizeFrac * height) &&
+           qAbs(subPixelX - rhs.subPixelX) <= prec.subPixel &&
+           qAbs(subPixelY - rhs.subPixelY) <= prec.subPixel &&
+           qAbs(softnessFactor - rhs.softnessFactor) <= prec.softnessFactor &&
+           qAbs(lightnessStrength - rhs.lightnessStrength) <= prec.lightnessStrength &&
+           qAbs(ratio - rhs.ratio) <= prec.ratio &&
+           index == rhs.index &&
+           mirrorProperties.horizontalMirror == rhs.mirrorProperties.horizontalMirror &&
+           mirrorProperties.verticalMirror == rhs.mirrorProperties.verticalMirror;
+}
+
+bool KisDabCacheBase::SavedDabParameters::equalsExactly(const SavedDabParameters &rhs) const
+{
+    return color == rhs.color &&
+           angle == rhs.angle &&
+           width == rhs.width &&
+           height == rhs.height &&
+           subPixelX == rhs.subPixelX &&
+           subPixelY == rhs.subPixelY &&
+           softnessFactor == rhs.softnessFactor &&
+           lightnessStrength == rhs.lightnessStrength &&
+           ratio == rhs.ratio &&
+           index == rhs.index &&
+           mirrorProperties.horizontalMirror == rhs.mirrorProperties.horizontalMirror &&
+           mirrorProperties.verticalMirror == rhs.mirrorProperties.verticalMirror;
+}
 
 struct KisDabCacheBase::Private {
 
@@ -112,7 +115,7 @@ void KisDabCacheBase::disableSubpixelPrecision()
     m_d->subPixelPrecisionDisabled = true;
 }
 
-inline KisDabCacheBase::SavedDabParameters
+KisDabCacheBase::SavedDabParameters
 KisDabCacheBase::getDabParameters(KisBrushSP brush,
                               const KoColor& color,
                               KisDabShape const& shape,
@@ -11,13 +11,14 @@
 #include "kis_brush.h"
 
 #include "KisDabCacheUtils.h"
+#include <KoColor.h>
+#include "kis_pressure_mirror_option.h"
 
 class KisColorSource;
 class KisPressureSharpnessOption;
 class KisTextureProperties;
 class KisPressureMirrorOption;
 class KisPrecisionOption;
-struct MirrorProperties;
 
 
 /**
@@ -86,11 +87,33 @@ protected:
                                 KisDabCacheUtils::DabGenerationInfo *di,
                                 bool *shouldUseCache);
 
+public:
+    /**
+     * The full set of parameters that determines the content of a
+     * generated dab. Public so that the cross-stroke dab cache can
+     * use it as its key.
+     */
+    struct SavedDabParameters {
+        KoColor color;
+        qreal angle;
+        int width;
+        int height;
+        qreal subPixelX;
+        qreal subPixelY;
+        qreal softnessFactor;
+        qreal lightnessStrength;
+        qreal ratio;
+        int index;
+        MirrorProperties mirrorProperties;
+
+        bool compare(const SavedDabParameters &rhs, int precisionLevel) const;
+        bool equalsExactly(const SavedDabParameters &rhs) const;
+    };
+
 private:
-    struct SavedDabParameters;
     struct DabPosition;
-private:
-    inline SavedDabParameters getDabParameters(KisBrushSP brush, const KoColor& color,
+protected:
+    SavedDabParameters getDabParameters(KisBrushSP brush, const KoColor& color,
                                                KisDabShape const&,
                                                const KisPaintInformation& info,
                                                double subPixelX, double subPixelY,
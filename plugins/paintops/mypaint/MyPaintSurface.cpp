@@ -171,7 +171,6 @@ int KisMyPaintSurface::drawDabImpl(MyPaintSurface *self, float x, float y, float
         }
 
         base_alpha = calculate_alpha_for_rr (rr, hardness, segment1_slope, segment2_slope);
-        m_tempPainter->selection();
         alpha = base_alpha * normal_mode;
 
         channelType* nativeArray = reinterpret_cast<channelType*>(it.rawData());
@@ -146,6 +146,20 @@ void KisSketchPaintOp::doPaintLine(const KisPaintInformation &pi1, const KisPain
     QPointF mousePosition = pi2.pos();
     m_points.append(mousePosition);
 
+    /**
+     * Bound the connection history: the main loop below scans every
+     * stored point per dab, so an unbounded history makes long
+     * scribble strokes O(n^2). Keeping the last few thousand points
+     * preserves the web-like look (connections only form within the
+     * brush radius anyway) while keeping the per-dab cost constant.
+     * The compaction drops the oldest half in one go, so it is
+     * amortized O(1) per dab.
+     */
+    static const int maxHistorySize = 4096;
+    if (m_points.size() > 2 * maxHistorySize) {
+        m_points.erase(m_points.begin(), m_points.end() - maxHistorySize);
+    }
+
 
     const qreal lodAdditionalScale = KisLodTransform::lodToScale(painter()->device());
     const qreal scale = lodAdditionalScale * m_sizeOption.apply(pi2);
@@ -104,6 +104,10 @@ void KisToolFill::deactivate()
 {
     KisToolPaint::deactivate();
     m_imageConnections.clear();
+
+    // don't keep the merged reference device alive while the tool
+    // is not in use
+    slotInvalidateReferenceCache();
 }
 
 
@@ -176,10 +180,26 @@ void KisToolFill::endPrimaryAction(KoPointerEvent *event)
         refPaintDevice = currentNode()->paintDevice();
     } else if (m_sampleLayersMode == SAMPLE_LAYERS_MODE_COLOR_LABELED) {
 
-        refPaintDevice = KisMergeLabeledLayersCommand::createRefPaintDevice(image(), "Fill Tool Reference Result Paint Device");
+        const QVector<QPair<const KisNode*, int>> signature =
+            referenceDeviceSignature(currentRoot);
+
+        if (m_cachedRefDevice &&
+            m_cachedRefDeviceColors == m_selectedColors &&
+            m_cachedRefDeviceSignature == signature) {
+
+            // the merged boundary reference is still valid: reuse it
+            // and skip the per-fill merge entirely
+            refPaintDevice = m_cachedRefDevice;
+        } else {
+            refPaintDevice = KisMergeLabeledLayersCommand::createRefPaintDevice(image(), "Fill Tool Reference Result Paint Device");
 
-        applicator.applyCommand(new KisMergeLabeledLayersCommand(refImage, refPaintDevice, currentRoot, m_selectedColors),
-                                KisStrokeJobData::SEQUENTIAL, KisStrokeJobData::EXCLUSIVE);
+            applicator.applyCommand(new KisMergeLabeledLayersCommand(refImage, refPaintDevice, currentRoot, m_selectedColors),
+                                    KisStrokeJobData::SEQUENTIAL, KisStrokeJobData::EXCLUSIVE);
+
+            m_cachedRefDevice = refPaintDevice;
+            m_cachedRefDeviceColors = m_selectedColors;
+            m_cachedRefDeviceSignature = signature;
+        }
     }
 
     KIS_ASSERT(refPaintDevice);
@@ -432,6 +452,38 @@ void KisToolFill::activateConnectionsToImage()
         m_imageConnections.addConnection(m_dummiesFacade, SIGNAL(sigDummyChanged(KisNodeDummy*)),
                                                      &m_colorLabelCompressor, SLOT(start()));
     }
+
+}
+
+void KisToolFill::slotInvalidateReferenceCache()
+{
+    m_cachedRefDevice = 0;
+    m_cachedRefDeviceColors.clear();
+    m_cachedRefDeviceSignature.clear();
+}
+
+QVector<QPair<const KisNode*, int>> KisToolFill::referenceDeviceSignature(KisNodeSP root) const
+{
+    /**
+     * The signature captures which labeled nodes contribute to the
+     * merged reference and the sequence numbers of their devices, so
+     * the cache survives the fills themselves (they modify other
+     * layers) but is dropped as soon as any source layer changes.
+     */
+    QVector<QPair<const KisNode*, int>> signature;
+
+    KisLayerUtils::recursiveApplyNodes(root,
+        [this, &signature] (KisNodeSP node) {
+            if (!m_selectedColors.contains(node->colorLabelIndex())) return;
+
+            KisPaintDeviceSP device = node->projection() ?
+                node->projection() : node->paintDevice();
+
+            signature.append(qMakePair(node.data(),
+                                       device ? device->sequenceNumber() : -1));
+        });
+
+    return signature;
 }
 
 void KisToolFill::deactivateConnectionsToImage()
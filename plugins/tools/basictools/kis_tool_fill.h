@@ -63,6 +63,7 @@ public Q_SLOTS:
 protected Q_SLOTS:
     void resetCursorStyle() override;
     void slotUpdateAvailableColorLabels();
+    void slotInvalidateReferenceCache();
 
 protected:
     bool wantsAutoScroll() const override { return false; }
@@ -94,6 +95,18 @@ private:
     bool m_useFastMode;
     QString m_sampleLayersMode;
     QList<int> m_selectedColors;
+
+    /**
+     * The merged reference device for the color-labeled sampling
+     * mode, reused across consecutive fills so that flatting
+     * sessions only pay the layer merge once. Invalidated whenever
+     * the image content or the selected labels change.
+     */
+    KisPaintDeviceSP m_cachedRefDevice;
+    QList<int> m_cachedRefDeviceColors;
+    QVector<QPair<const KisNode*, int>> m_cachedRefDeviceSignature;
+
+    QVector<QPair<const KisNode*, int>> referenceDeviceSignature(KisNodeSP root) const;
     qreal m_patternRotation;
     qreal m_patternScale;
 